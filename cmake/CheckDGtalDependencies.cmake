@@ -30,6 +30,27 @@ ELSE(GMP_FOUND)
    message(STATUS "(optional) gmp not found." )
 ENDIF(GMP_FOUND)
 
+# -----------------------------------------------------------------------------
+# Look for OpenMP, used by parallel domain traversals.
+# (They are not compulsory).
+# -----------------------------------------------------------------------------
+# The flags are carried by the imported target OpenMP::OpenMP_CXX,
+# which reaches the targets linked with DGtal through
+# DGtalLibDependencies. WITH_OPENMP is a compile definition of the
+# DGtal library (see src/CMakeLists.txt), set only when OpenMP is
+# found and USE_OPENMP is ON.
+SET(WITH_OPENMP 0)
+IF(USE_OPENMP)
+  FIND_PACKAGE(OpenMP)
+  IF(OPENMP_FOUND AND TARGET OpenMP::OpenMP_CXX)
+    SET(WITH_OPENMP 1)
+    SET(DGtalLibDependencies ${DGtalLibDependencies} OpenMP::OpenMP_CXX)
+    message(STATUS "(optional) OpenMP found." )
+  ELSE(OPENMP_FOUND AND TARGET OpenMP::OpenMP_CXX)
+    message(STATUS "(optional) OpenMP not found." )
+  ENDIF(OPENMP_FOUND AND TARGET OpenMP::OpenMP_CXX)
+ENDIF(USE_OPENMP)
+
 # -----------------------------------------------------------------------------
 # Look for GraphicsMagic
 # (They are not compulsory).
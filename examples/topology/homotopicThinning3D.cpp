@@ -29,12 +29,12 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
-#include <queue>
 #include <QImageReader>
 #include <QtGui/qapplication.h>
 #include "DGtal/io-viewers/3dViewers/DGtalQGLViewer.h"
 #include "DGtal/helpers/Shapes.h"
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HomotopicThinning.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -75,30 +75,11 @@ int main( int argc, char** argv )
   
 
   Object6_26 shape( dt6_26, shape_set );
-  int nb_simple=0; 
-  int layer = 0;
-  do 
-    {
-      DigitalSet & S = shape.pointSet();
-      std::queue<DigitalSet::Iterator> Q;
-      for ( DigitalSet::Iterator it = S.begin(); it != S.end(); ++it )
-	if ( shape.isSimple( *it ) )
-	  Q.push( it );
-      nb_simple = 0;
-      while ( ! Q.empty() )
-	{
-	  DigitalSet::Iterator it = Q.front();
-	  Q.pop();
-	  if ( shape.isSimple( *it ) )
-	    {
-	      cerr << "point simple " << (*it) << endl; 
-	      S.erase( *it );
-	      ++nb_simple;
-	    }
-	}
-      ++layer;
-    }
-  while ( nb_simple != 0 );
+  trace.beginBlock( "Thinning" );
+  HomotopicThinning<Object6_26> thinning( shape );
+  unsigned int nb_simple = thinning.thin();
+  trace.info() << nb_simple << " simple points removed" << endl;
+  trace.endBlock();
 
   DigitalSet & S = shape.pointSet();
 
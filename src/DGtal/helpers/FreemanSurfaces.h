@@ -0,0 +1,328 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FreemanSurfaces.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module FreemanSurfaces.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FreemanSurfaces_RECURSES)
+#error Recursive header files inclusion detected in FreemanSurfaces.h
+#else // defined(FreemanSurfaces_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FreemanSurfaces_RECURSES
+
+#if !defined FreemanSurfaces_h
+/** Prevents repeated inclusion of headers. */
+#define FreemanSurfaces_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <deque>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/helpers/Surfaces.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FreemanSurfaces
+  /**
+     Description of template class 'FreemanSurfaces' <p> \brief Aim: A
+     utility class for extracting the contours of 2D shapes directly
+     as Freeman chains, with the contour tracking of Surfaces.
+
+     @tparam TKSpace the type of a 2D cellular grid space (e.g. a
+     KhalimskySpaceND<2>).
+   */
+  template <typename TKSpace>
+  class FreemanSurfaces
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+       Tracks the 2D contour of [start_surfel] like Surfaces::track2DBoundary,
+       but directly as a Freeman chain: the code of each linel is
+       appended when the linel is met, without building the vector of
+       surfels nor the vector of its pointels. The chain is the one
+       built from the points given by Surfaces::extractAllPointContours4C for
+       the same contour.
+
+       @tparam DigitalSet a model of a digital set (e.g., std::set<Point>).
+
+       @param aChain (modified) the Freeman chain of the contour.
+       @param K any 2D space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param shape any digital set.
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+    */
+    template <typename DigitalSet >
+    static
+    void track2DFreemanChain( FreemanChain<Integer> & aChain,
+			      const KSpace & K,
+			      const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+			      const DigitalSet & shape,
+			      const SCell & start_surfel );
+
+    /**
+       Tracks the 2D contour of [start_surfel] directly as a Freeman
+       chain, and computes its bounding box during the tracking.
+
+       @tparam DigitalSet a model of a digital set (e.g., std::set<Point>).
+
+       @param aChain (modified) the Freeman chain of the contour.
+       @param aLowerBB (returns) the lowest point of the bounding box of
+       the chain.
+       @param aUpperBB (returns) the highest point of the bounding box
+       of the chain.
+       @param K any 2D space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param shape any digital set.
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+    */
+    template <typename DigitalSet >
+    static
+    void track2DFreemanChain( FreemanChain<Integer> & aChain,
+			      Point & aLowerBB, Point & aUpperBB,
+			      const KSpace & K,
+			      const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+			      const DigitalSet & shape,
+			      const SCell & start_surfel );
+
+    /**
+       Extracts all the contours of a 2D shape as Freeman chains, in
+       a single raster pass like Surfaces::extractAll2DSCellContours. The chains
+       are the ones built from the contours given by
+       Surfaces::extractAllPointContours4C, in the same order.
+
+       @tparam DigitalSet a model of a digital set (e.g., std::set<Point>).
+
+       @param aVectChains (modified) the Freeman chains of the contours.
+       @param aKSpace any 2D space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param aShape any digital set.
+    */
+    template <typename DigitalSet >
+    static
+    void extractAllFreemanChains( std::vector< FreemanChain<Integer> > & aVectChains,
+				  const KSpace & aKSpace,
+				  const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+				  const DigitalSet & aShape );
+
+    /**
+       Extracts all the contours of a 2D shape as Freeman chains, with
+       the bounding box of each chain computed during the tracking.
+
+       @tparam DigitalSet a model of a digital set (e.g., std::set<Point>).
+
+       @param aVectChains (modified) the Freeman chains of the contours.
+       @param aVectBoundingBoxes (modified) the lowest and highest
+       points of the bounding box of each chain.
+       @param aKSpace any 2D space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param aShape any digital set.
+    */
+    template <typename DigitalSet >
+    static
+    void extractAllFreemanChains( std::vector< FreemanChain<Integer> > & aVectChains,
+				  std::vector< std::pair<Point, Point> > & aVectBoundingBoxes,
+				  const KSpace & aKSpace,
+				  const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+				  const DigitalSet & aShape );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~FreemanSurfaces();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    FreemanSurfaces();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FreemanSurfaces ( const FreemanSurfaces & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FreemanSurfaces & operator= ( const FreemanSurfaces & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    typedef Surfaces<KSpace> Tracking;
+    typedef typename Tracking::SpelMask SpelMask;
+    typedef typename Tracking::Size Size;
+
+    /**
+     * Builds a contour as a Freeman chain, the code of each linel
+     * being computed when it is added. Also computes the bounding box
+     * of the pointels of the contour and its smallest surfel, and
+     * marks its surfels as visited.
+     */
+    struct FreemanContourBuilder
+    {
+      FreemanContourBuilder( const KSpace & K, FreemanChain<Integer> & chain,
+			     std::vector<bool> * visited );
+      void add( const SCell & b );
+      void reverse();
+
+      /**
+       * Sets the first and last points of the chain, and completes
+       * the bounding box.
+       * @param closed 'true' iff the contour is closed.
+       * @param endWithMin when 'true' and the contour is closed, the
+       * chain is rotated so that its last linel is the smallest surfel.
+       */
+      void finish( bool closed, bool endWithMin );
+
+      const KSpace & myK;
+      FreemanChain<Integer> & myChain;
+      std::vector<bool> * myVisited;
+      /// The first and last surfels of the contour.
+      SCell myFirst, myLast;
+      /// The smallest surfel of the contour and its position.
+      SCell myMin;
+      Size myMinPosition;
+      /// The bounding box of the pointels of the contour.
+      Point myLowerBB, myUpperBB;
+    };
+
+    /**
+     * @param K any 2D space.
+     * @param linel any signed linel.
+     * @return the pointel where [linel] starts, when seen as a
+     * counterclockwise oriented edge of the boundary.
+     */
+    static Point linelBegin( const KSpace & K, const SCell & linel );
+
+    /**
+     * @param K any 2D space.
+     * @param linel any signed linel.
+     * @return the pointel where [linel] ends.
+     */
+    static Point linelEnd( const KSpace & K, const SCell & linel );
+
+    /**
+     * @param K any 2D space.
+     * @param linel any signed linel.
+     * @return the Freeman code ('0' to '3') of [linel].
+     */
+    static char freemanCode( const KSpace & K, const SCell & linel );
+
+    /**
+     * Tracks contours as Freeman chains (used by extractAllFreemanChains).
+     */
+    struct FreemanContourTracker
+    {
+      FreemanContourTracker( const KSpace & K,
+			     const SurfelAdjacency<KSpace::dimension> & adj );
+      void track( const SpelMask & mask, const SCell & bel,
+		  std::vector<bool> & visited );
+
+      const KSpace & myK;
+      const SurfelAdjacency<KSpace::dimension> & myAdj;
+      /// The chains, in raster order.
+      std::deque< FreemanChain<Integer> > myChains;
+      /// The bounding box of each chain.
+      std::vector< std::pair<Point, Point> > myBoundingBoxes;
+      /// The smallest surfel of each contour and its index.
+      std::vector< std::pair<SCell, Size> > myOrder;
+    };
+
+  }; // end of class FreemanSurfaces
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FreemanSurfaces'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FreemanSurfaces' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const FreemanSurfaces<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/helpers/FreemanSurfaces.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FreemanSurfaces_h
+
+#undef FreemanSurfaces_RECURSES
+#endif // else defined(FreemanSurfaces_RECURSES)
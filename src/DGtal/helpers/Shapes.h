@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/helpers/CShape.h"
@@ -84,12 +85,20 @@ namespace DGtal
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
      * an instance of ShapeFunctor.
      * 
+     * With several threads, the shape bounding box is split into
+     * slabs whose points are tested concurrently (see
+     * HyperRectDomainTraversal::parallelSelect), so aFunctor.isInside
+     * must then be safe to call from several threads.
+     *
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
+     * @param nbThreads the number of threads testing the points (1 by
+     * default, 0 means HyperRectDomainTraversal::defaultNbThreads()).
      */
     template <typename TDigitalSet, typename TShapeFunctor>
     static void shaper( TDigitalSet & aSet,
-			const TShapeFunctor & aFunctor);
+			const TShapeFunctor & aFunctor,
+			unsigned int nbThreads = 1 );
     
     /**
      * Adds the discrete ball (norm-1) of center [aCenter] and radius
@@ -207,6 +216,19 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Predicate on points telling if a point is inside a shape.
+     */
+    template <typename TShapeFunctor>
+    struct InsidePredicate
+    {
+      InsidePredicate( const TShapeFunctor & aFunctor )
+	: myFunctor( &aFunctor ) {}
+      bool operator()( const Point & p ) const
+      { return myFunctor->isInside( p ); }
+      const TShapeFunctor* myFunctor;
+    };
+
   }; // end of class Shapes
 
 
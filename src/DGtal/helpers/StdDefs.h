@@ -166,6 +166,112 @@ namespace DGtal
     static const DT26_6 dt26_6 = DT26_6( adj26, adj6, JORDAN_DT );
   } // namespace Z3i
 
+  /**
+   * This namespace gathers the same type definitions as Z2i, but with
+   * integers represented by 'int16_t'. Points, sets and contours then
+   * take half the memory of their Z2i counterparts. Digital
+   * coordinates should lie within [-16383,16383] so that the
+   * Khalimsky coordinates of cells are representable.
+   *
+   * Points are converted from and to Z2i with the conversion
+   * constructor of PointVector, e.g. Z2i16::Point( Z2i::Point( 3, 4 ) ).
+   */
+  namespace Z2i16 {
+    typedef DGtal::int16_t Integer;
+    typedef SpaceND< 2, Integer > Space;
+    typedef Space Z2;
+    typedef KhalimskySpaceND< 2, Integer > KSpace;
+    typedef KSpace K2;
+    typedef KSpace::Cell Cell;
+    typedef KSpace::SCell SCell;
+    typedef KSpace::Cells Cells;
+    typedef KSpace::SCells SCells;
+    /** Standard 4-neighborhood for a 2D digital space. */
+    typedef MetricAdjacency< Space, 1> Adj4;
+    /** Standard 8-neighborhood for a 2D digital space. */
+    typedef MetricAdjacency< Space, 2> Adj8;
+    typedef DigitalTopology< Adj4, Adj8 > DT4_8;
+    typedef DigitalTopology< Adj8, Adj4 > DT8_4;
+    typedef Space::Point Point;
+    typedef Space::Vector Vector;
+    typedef HyperRectDomain< Space > Domain; 
+    typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+    typedef Object<DT4_8, DigitalSet> Object4_8;
+    typedef Object<DT4_8, DigitalSet>::ComplementObject ComplementObject4_8;
+    typedef Object<DT4_8, DigitalSet>::SmallObject SmallObject4_8;
+    typedef Object<DT4_8, DigitalSet>::SmallComplementObject SmallComplementObject4_8;
+    typedef Object<DT8_4, DigitalSet> Object8_4;
+    typedef Object<DT8_4, DigitalSet>::ComplementObject ComplementObject8_4;
+    typedef Object<DT8_4, DigitalSet>::SmallObject SmallObject8_4;
+    typedef Object<DT8_4, DigitalSet>::SmallComplementObject SmallComplementObject8_4;
+
+
+    static const Adj4 adj4;
+    static const Adj8 adj8;
+    static const DT4_8 dt4_8 = DT4_8( adj4, adj8, JORDAN_DT );
+    static const DT8_4 dt8_4 = DT8_4( adj8, adj4, JORDAN_DT );
+  } // namespace Z2i16
+
+  /**
+   * This namespace gathers the same type definitions as Z3i, but with
+   * integers represented by 'int16_t'. Points, sets and surfaces then
+   * take half the memory of their Z3i counterparts. Digital
+   * coordinates should lie within [-16383,16383] so that the
+   * Khalimsky coordinates of cells are representable.
+   *
+   * Points are converted from and to Z3i with the conversion
+   * constructor of PointVector, e.g. Z3i16::Point( Z3i::Point( 3, 4, 5 ) ).
+   */
+  namespace Z3i16 {
+    typedef DGtal::int16_t Integer;
+    typedef SpaceND< 3, Integer > Space;
+    typedef Space Z3;
+    typedef KhalimskySpaceND< 3, Integer > KSpace;
+    typedef KSpace K3;
+    typedef KSpace::Cell Cell;
+    typedef KSpace::SCell SCell;
+    typedef KSpace::Cells Cells;
+    typedef KSpace::SCells SCells;
+    /** Standard 6-neighborhood for a 3D digital space. */
+    typedef MetricAdjacency< Space, 1> Adj6;
+    /** Standard 18-neighborhood for a 3D digital space. */
+    typedef MetricAdjacency< Space, 2> Adj18;
+    /** Standard 26-neighborhood for a 3D digital space. */
+    typedef MetricAdjacency< Space, 3> Adj26;
+    typedef DigitalTopology< Adj6, Adj18 > DT6_18;
+    typedef DigitalTopology< Adj18, Adj6 > DT18_6;
+    typedef DigitalTopology< Adj6, Adj26 > DT6_26;
+    typedef DigitalTopology< Adj26, Adj6 > DT26_6;
+    typedef Space::Point Point;
+    typedef Space::Vector Vector;
+    typedef HyperRectDomain< Space > Domain; 
+    typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+    typedef Object<DT6_18, DigitalSet> Object6_18;
+    typedef Object<DT6_18, DigitalSet>::ComplementObject ComplementObject6_18;
+    typedef Object<DT6_18, DigitalSet>::SmallObject SmallObject6_18;
+    typedef Object<DT6_18, DigitalSet>::SmallComplementObject SmallComplementObject6_18;
+    typedef Object<DT18_6, DigitalSet> Object18_6;
+    typedef Object<DT18_6, DigitalSet>::ComplementObject ComplementObject18_6;
+    typedef Object<DT18_6, DigitalSet>::SmallObject SmallObject18_6;
+    typedef Object<DT18_6, DigitalSet>::SmallComplementObject SmallComplementObject18_6;
+    typedef Object<DT6_26, DigitalSet> Object6_26;
+    typedef Object<DT6_26, DigitalSet>::ComplementObject ComplementObject6_26;
+    typedef Object<DT6_26, DigitalSet>::SmallObject SmallObject6_26;
+    typedef Object<DT6_26, DigitalSet>::SmallComplementObject SmallComplementObject6_26;
+    typedef Object<DT26_6, DigitalSet> Object26_6;
+    typedef Object<DT26_6, DigitalSet>::ComplementObject ComplementObject26_6;
+    typedef Object<DT26_6, DigitalSet>::SmallObject SmallObject26_6;
+    typedef Object<DT26_6, DigitalSet>::SmallComplementObject SmallComplementObject26_6;
+
+    static const Adj6 adj6;
+    static const Adj18 adj18;
+    static const Adj26 adj26;
+    static const DT6_18 dt6_18 = DT6_18( adj6, adj18, JORDAN_DT );
+    static const DT18_6 dt18_6 = DT18_6( adj18, adj6, JORDAN_DT );
+    static const DT6_26 dt6_26 = DT6_26( adj6, adj26, JORDAN_DT );
+    static const DT26_6 dt26_6 = DT26_6( adj26, adj6, JORDAN_DT );
+  } // namespace Z3i16
+
   
 /////////////////////////////////////////////////////////////////////////////
 // class StdDefs
@@ -41,8 +41,15 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <deque>
+#include <utility>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
 
@@ -102,7 +109,9 @@ namespace DGtal
        boundary component of the digital set [shape]. The algorithms
        tracks surfels along the boundary of the shape.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell whose 'insert'
+       returns a pair like std::set (e.g., std::set<SCell> or the
+       faster SurfelSet<KSpace>).
        @tparam DigitalSet a model of a digital set (e.g., std::set<Point>)..
        
        @param surface (modified) a set of cells (which are all surfels),
@@ -218,6 +227,13 @@ namespace DGtal
      @param aKSpace any space.
      @param aSurfelAdj the surfel adjacency chosen for the tracking.
      @param aShape any digital set.
+
+     The shape is written in a byte mask over the space, which is
+     scanned once row by row. Each boundary surfel met that was not
+     visited yet starts the tracking of a new contour, whose surfels
+     are marked in a bitmap of visited cells. Contours are given as
+     track2DBoundary would give them from their smallest surfel, and
+     sorted by smallest surfel.
   */
     template <typename DigitalSet >
     static 
@@ -225,9 +241,7 @@ namespace DGtal
 			       const KSpace & aKSpace,
 			       const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
 			       const DigitalSet & aShape );
-    
 
-    
     /**
        Creates a set of signed surfels whose elements represents a
        boundary component of the digital set [shape]. The algorithms
@@ -237,7 +251,9 @@ namespace DGtal
        the idea of Artzy, Frieder and Herman algorithm
        [Artzy:1981-cgip], but in nD.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell whose 'insert'
+       returns a pair like std::set (e.g., std::set<SCell> or the
+       faster SurfelSet<KSpace>).
        @tparam DigitalSet a model of a digital set (e.g., std::set<Point>)..
        
        @param surface (modified) a set of cells (which are all surfels),
@@ -271,13 +287,23 @@ namespace DGtal
      @param aSurfelAdj the surfel adjacency chosen for the tracking.
      @param aSpelSet any digital set.
      @param aLowerBound and @param aUpperBound Cell giving the bounds of the extracted boundary.
+     @param nbThreads the number of threads scanning the slabs of the
+     bounds (0 means HyperRectDomainTraversal::defaultNbThreads()).
+
+     The spels of [aSpelSet] lying within the bounds are first
+     written in a byte mask, which is then scanned row by row: a
+     surfel is emitted wherever the mask changes between a spel and
+     its successor along some axis. Slabs of rows are scanned
+     concurrently into separate buffers, which are then inserted in
+     [aBoundary] in the order of the rows.
   */
     template <typename SCellSet, typename DigitalSet >
     static 
     void uMakeBoundary( SCellSet & aBoundary,
 			const KSpace & aKSpace,
 			const DigitalSet & aSpelSet,
-			const Cell aLowerBound, const Cell aUpperBound  );
+			const Cell aLowerBound, const Cell aUpperBound,
+			unsigned int nbThreads = 0 );
     
  /**
      Creates a set of signed surfels whose elements represents all
@@ -293,18 +319,127 @@ namespace DGtal
      @param aSurfelAdj the surfel adjacency chosen for the tracking.
      @param aSpelSet any digital set.
      @param aLowerBound and @param aUpperBound Cell giving the bounds of the extracted boundary.
+     @param nbThreads the number of threads scanning the slabs of the
+     bounds (0 means HyperRectDomainTraversal::defaultNbThreads()).
+
+     The spels of [aSpelSet] lying within the bounds are first
+     written in a byte mask, which is then scanned row by row: a
+     surfel is emitted wherever the mask changes between a spel and
+     its successor along some axis. Slabs of rows are scanned
+     concurrently into separate buffers, which are then inserted in
+     [aBoundary] in the order of the rows.
   */
     template <typename SCellSet, typename DigitalSet >
     static 
     void sMakeBoundary( SCellSet & aBoundary,
 			const KSpace & aKSpace,
 			const DigitalSet & aSpelSet,
-			const Cell aLowerBound, const Cell aUpperBound  );
+			const Cell aLowerBound, const Cell aUpperBound,
+			unsigned int nbThreads = 0 );
     
 
 
     
 
+    // ----------------------- 2D contour tracking ----------------------------
+  public:
+    // The building blocks of the 2D contour extraction, for the
+    // contour builders of other helpers (e.g. FreemanSurfaces).
+    typedef HyperRectDomain<typename KSpace::Space> SpelDomain;
+    typedef HyperRectDomainTraversal<SpelDomain> SpelTraversal;
+    typedef HyperRectDomainLinearizer<SpelDomain> SpelLinearizer;
+    typedef typename SpelDomain::Size Size;
+
+    /**
+     * A byte mask over a box of spels, whose value is 1 for the spels
+     * of some digital set. It is also a predicate on the points of
+     * the box.
+     */
+    struct SpelMask
+    {
+      /**
+       * Constructor. The mask is filled with the points of [aSpelSet]
+       * lying in the box.
+       * @param lower the lowest spel of the box.
+       * @param upper the highest spel of the box.
+       * @param aSpelSet any digital set.
+       */
+      template <typename DigitalSet>
+      SpelMask( const Point & lower, const Point & upper,
+		const DigitalSet & aSpelSet );
+
+      /**
+       * @param p any point of the box.
+       * @return the index of [p] in myMask.
+       */
+      Size index( const Point & p ) const;
+
+      /**
+       * @param p any point of the box.
+       * @return 'true' iff [p] belongs to the digital set.
+       */
+      bool operator()( const Point & p ) const;
+
+      /// The numbering of the spels of the box.
+      SpelLinearizer myLinearizer;
+      /// The mask.
+      std::vector<unsigned char> myMask;
+    };
+
+    /**
+     * @param K any space.
+     * @param c any cell of [K].
+     * @return the index of [c] among the cells of [K], ordered by
+     * Khalimsky coordinates (the first one varying fastest).
+     */
+    static Size cellIndex( const KSpace & K, const SCell & c );
+
+    /**
+     * Tracks the 2D contour of [start] like track2DBoundary, the
+     * spels being given by a predicate. The surfels met backward from
+     * [start] (including [start]) are given to the builder first,
+     * followed by a call to its 'reverse()' method, then the surfels
+     * met forward. The tracking stops at the space borders or when
+     * [start] is met again.
+     *
+     * @tparam PointPredicate any predicate on points.
+     * @tparam ContourBuilder any type with methods 'add( const SCell & )'
+     * and 'reverse()', like SCellContourBuilder.
+     * @param aBuilder the builder of the contour.
+     * @param K any space.
+     * @param aSurfelAdj the surfel adjacency chosen for the tracking.
+     * @param aShape the predicate of the points of the shape.
+     * @param start any boundary surfel of the shape.
+     * @return 'true' iff the contour is closed.
+     */
+    template <typename PointPredicate, typename ContourBuilder>
+    static
+    bool track2DContour( ContourBuilder & aBuilder,
+			 const KSpace & K,
+			 const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+			 const PointPredicate & aShape,
+			 const SCell & start );
+
+    /**
+     * Tracks the contours of a 2D shape with a bitmap of visited
+     * surfels: the shape is written in a byte mask over the space,
+     * which is scanned row by row, and each unvisited boundary surfel
+     * is given to [aTracker].
+     *
+     * @tparam ContourTracker any type with method 'track( const
+     * SpelMask &, const SCell &, std::vector<bool> & )', which tracks
+     * the contour of the given surfel and marks its surfels in the
+     * bitmap (indexed by cellIndex).
+     * @param aTracker the tracker of the contours.
+     * @param aKSpace any space.
+     * @param aShape any digital set.
+     */
+    template <typename ContourTracker, typename DigitalSet>
+    static
+    void scanAll2DContours( ContourTracker & aTracker,
+			    const KSpace & aKSpace,
+			    const DigitalSet & aShape );
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -361,6 +496,91 @@ namespace DGtal
 
     // ------------------------- Internals ------------------------------------
   private:
+    /**
+     * Emits the boundary surfels of the rows of a SpelMask (used by
+     * uMakeBoundary and sMakeBoundary).
+     */
+    struct BoundaryRowScanner
+    {
+      /**
+       * Constructor.
+       * @param K the space.
+       * @param mask the mask of the spels.
+       * @param output the vector where the surfels are added.
+       */
+      BoundaryRowScanner( const KSpace & K, const SpelMask & mask,
+			  std::vector<SCell> & output );
+
+      /**
+       * Emits the surfels between the spels of the row and their
+       * successors along each axis, the surfels along the row first.
+       * @param start the first spel of the row.
+       * @param length the number of spels of the row.
+       */
+      void operator()( const Point & start, Size length );
+
+      const KSpace & myK;
+      const SpelMask & myMask;
+      std::vector<SCell> & myOutput;
+    };
+
+    /**
+     * Builds a contour as a vector of surfels, and marks its surfels
+     * as visited.
+     */
+    struct SCellContourBuilder
+    {
+      SCellContourBuilder( const KSpace & K, std::vector<SCell> & contour,
+			   std::vector<bool> * visited );
+      void add( const SCell & b );
+      void reverse();
+
+      const KSpace & myK;
+      std::vector<SCell> & myContour;
+      std::vector<bool> * myVisited;
+    };
+
+    /**
+     * Tracks contours as vectors of surfels (used by
+     * extractAll2DSCellContours).
+     */
+    struct SCellContourTracker
+    {
+      SCellContourTracker( const KSpace & K,
+			   const SurfelAdjacency<KSpace::dimension> & adj );
+      void track( const SpelMask & mask, const SCell & bel,
+		  std::vector<bool> & visited );
+
+      const KSpace & myK;
+      const SurfelAdjacency<KSpace::dimension> & myAdj;
+      /// The contours, in raster order.
+      std::deque< std::vector<SCell> > myContours;
+      /// The smallest surfel of each contour and its index.
+      std::vector< std::pair<SCell, Size> > myOrder;
+    };
+
+    /**
+     * Computes the boundary surfels of [aSpelSet] within the given
+     * bounds, in the order of the rows of the bounds. The surfel
+     * between a spel p and its successor along k is the forward
+     * incident cell of p along k, p being positive iff it belongs to
+     * [aSpelSet].
+     *
+     * @param aBoundary (modified) the vector where the surfels are added.
+     * @param aKSpace any space.
+     * @param aSpelSet any digital set.
+     * @param aLowerBound the lowest spel of the bounds.
+     * @param aUpperBound the highest spel of the bounds.
+     * @param nbThreads the number of threads (0 means
+     * SpelTraversal::defaultNbThreads()).
+     */
+    template <typename DigitalSet>
+    static
+    void scanBoundary( std::vector<SCell> & aBoundary,
+		       const KSpace & aKSpace,
+		       const DigitalSet & aSpelSet,
+		       const Cell aLowerBound, const Cell aUpperBound,
+		       unsigned int nbThreads );
 
   }; // end of class Surfaces
 
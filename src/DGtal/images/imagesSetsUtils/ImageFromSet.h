@@ -41,7 +41,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
 #include "DGtal/base/Common.h"
+#include "DGtal/utils/ConceptUtils.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
 #include "DGtal/images/CImageContainer.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 
@@ -50,6 +53,46 @@
 namespace DGtal
 {
 
+  template <typename TDomain, typename TValue>
+  class ImageContainerBySTLVector;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageParallelWriteTraits
+  /**
+   * Description of template class 'ImageParallelWriteTraits' <p>
+   * \brief Aim: Tells if setValue may be called concurrently on
+   * distinct points of an image. This is not the case in general
+   * (e.g. maps and trees change their structure when a value is
+   * set), so the default is TagFalse.
+   *
+   * @tparam TImage any model of CImageContainer.
+   */
+  template <typename TImage>
+  struct ImageParallelWriteTraits
+  {
+    typedef TagFalse IsParallelWritable;
+  };
+
+  /**
+   * Specialization for images stored in a std::vector: distinct points
+   * are distinct cells of the vector.
+   */
+  template <typename TDomain, typename TValue>
+  struct ImageParallelWriteTraits< ImageContainerBySTLVector<TDomain,TValue> >
+  {
+    typedef TagTrue IsParallelWritable;
+  };
+
+  /**
+   * Specialization for images of booleans: std::vector<bool> packs
+   * several values in the same word.
+   */
+  template <typename TDomain>
+  struct ImageParallelWriteTraits< ImageContainerBySTLVector<TDomain,bool> >
+  {
+    typedef TagFalse IsParallelWritable;
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class ImageFromSet
   /**
@@ -148,6 +191,69 @@ namespace DGtal
     {
       append(aImage,aSet,defaultValue,aSet.begin(),aSet.end());
     }
+
+    /** 
+     * Append a Set to an existing image, like append, but the values
+     * are set by several threads. This is only done when the image
+     * can be written concurrently on distinct points (see
+     * ImageParallelWriteTraits) and the set iterators are random
+     * access iterators (e.g. DigitalSetBySTLVector); otherwise, the
+     * points are appended serially.
+     * 
+     * @tparam Set model of CDigitalSet
+     * @param aImage an image
+     * @param aSet  an instance of Set to convert into an image
+     * @param defaultValue the default value for points in the set
+     * @param nbThreads the number of threads (0 means
+     * HyperRectDomainTraversal::defaultNbThreads()).
+     */
+    template<typename Set>
+    static
+    void parallelAppend(Image &aImage, const Set &aSet,
+			const Value &defaultValue,
+			unsigned int nbThreads = 0);
+
+  private:
+
+    /**
+     * Serial version of parallelAppend, for images that cannot be
+     * written concurrently.
+     */
+    template<typename SetConstIterator>
+    static
+    void appendPoints(Image &aImage, const Value &defaultValue,
+		SetConstIterator itBegin, SetConstIterator itEnd,
+		unsigned int nbThreads, TagFalse );
+
+    /**
+     * Version of parallelAppend for images that can be written
+     * concurrently, which dispatches on the iterator category.
+     */
+    template<typename SetConstIterator>
+    static
+    void appendPoints(Image &aImage, const Value &defaultValue,
+		SetConstIterator itBegin, SetConstIterator itEnd,
+		unsigned int nbThreads, TagTrue );
+
+    /**
+     * Serial version of parallelAppend, for sets whose points cannot
+     * be shared among threads without a copy.
+     */
+    template<typename SetConstIterator>
+    static
+    void appendPoints(Image &aImage, const Value &defaultValue,
+		SetConstIterator itBegin, SetConstIterator itEnd,
+		unsigned int nbThreads, std::forward_iterator_tag );
+
+    /**
+     * Parallel version of parallelAppend, the threads sharing the
+     * range of points.
+     */
+    template<typename SetConstIterator>
+    static
+    void appendPoints(Image &aImage, const Value &defaultValue,
+		SetConstIterator itBegin, SetConstIterator itEnd,
+		unsigned int nbThreads, std::random_access_iterator_tag );
   }   ; // end of class ImageFromSet
 
 
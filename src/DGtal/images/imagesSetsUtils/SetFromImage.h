@@ -41,7 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
 #include "DGtal/images/CImageContainer.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/images/imagesSetsUtils/SimpleForegroundPredicate.h"
@@ -133,6 +135,28 @@ namespace DGtal
       append(aSet,aImage,isForeground,domain.begin(),domain.end());
     }
 
+    /** 
+     * Append a Set to an existing image, like append, but the
+     * predicate is evaluated concurrently on slabs of the image
+     * domain (see HyperRectDomainTraversal::parallelSelect). The
+     * selected points are then inserted in the set at once.
+     * @pre the ForegroundPredicate instance must have been created on the image aImage.
+     * @pre the const operator() of isForeground (and thus the image
+     * accesses it does) must be safe to call from several threads.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground instance of ForegroundPredicate to decide
+     * which points to copy.
+     * @param nbThreads the number of threads (0 means
+     * HyperRectDomainTraversal::defaultNbThreads()).
+     */
+    template<typename Image,typename ForegroundPredicate>
+    static
+    void parallelAppend(Set &aSet, const Image &aImage,
+			const ForegroundPredicate &isForeground,
+			unsigned int nbThreads = 0);
+
     /** 
      * Append a Set to an existing image. Only points in the Set
      * contained in the image domain are considered. 
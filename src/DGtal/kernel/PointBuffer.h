@@ -0,0 +1,265 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointBuffer.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PointBuffer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointBuffer_RECURSES)
+#error Recursive header files inclusion detected in PointBuffer.h
+#else // defined(PointBuffer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointBuffer_RECURSES
+
+#if !defined PointBuffer_h
+/** Prevents repeated inclusion of headers. */
+#define PointBuffer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/array.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointBuffer
+  /**
+   * Description of template class 'PointBuffer' <p> \brief Aim: A
+   * sequence of points stored as a structure of arrays: one
+   * contiguous column per coordinate, instead of a vector of
+   * PointVector.
+   *
+   * Bulk operations (translation, bounding box, filtering by a box,
+   * Morton keys) run column by column, so that their inner loop is a
+   * plain loop over integers that the compiler vectorizes across
+   * points. Points are converted from and to the usual containers
+   * with the range constructor, assign and copyTo.
+   *
+   * @code
+   * std::vector<Z3i::Point> points = ...;
+   * PointBuffer<3,int> buffer( points.begin(), points.end() );
+   * buffer.translate( Z3i::Point( 1, 0, 0 ) );
+   * buffer.keepInside( domain );
+   * buffer.sort();
+   * buffer.copyTo( std::back_inserter( points ) );
+   * @endcode
+   *
+   * @tparam dim the dimension of the points.
+   * @tparam TInteger the type of coordinates.
+   */
+  template <Dimension dim, typename TInteger>
+  class PointBuffer
+  {
+  public:
+    typedef TInteger Integer;
+    typedef PointVector<dim,Integer> Point;
+    typedef typename std::vector<Integer>::size_type Size;
+    /// The type of a column of coordinates.
+    typedef std::vector<Integer> Column;
+    static const Dimension dimension = dim;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The buffer is empty.
+     */
+    PointBuffer();
+
+    /**
+     * Constructor from a range of points.
+     * @param first an iterator on the first point.
+     * @param last an iterator after the last point.
+     */
+    template <typename TInputIterator>
+    PointBuffer( TInputIterator first, TInputIterator last );
+
+    /**
+     * Replaces the points of the buffer with a range of points.
+     * @param first an iterator on the first point.
+     * @param last an iterator after the last point.
+     */
+    template <typename TInputIterator>
+    void assign( TInputIterator first, TInputIterator last );
+
+    /**
+     * Writes the points of the buffer, in order, to an output iterator.
+     * @param out any output iterator on points.
+     * @return the output iterator after the last written point.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator copyTo( TOutputIterator out ) const;
+
+    /// @return the number of points.
+    Size size() const;
+    /// @return 'true' iff there is no point.
+    bool empty() const;
+    /// Removes all the points.
+    void clear();
+    /// Reserves memory for [n] points.
+    void reserve( Size n );
+
+    /**
+     * Adds a point at the end of the buffer.
+     * @param p any point.
+     */
+    void push_back( const Point & p );
+
+    /**
+     * @param i an index in [0,size()).
+     * @return the [i]-th point.
+     */
+    Point operator[]( Size i ) const;
+
+    /**
+     * Sets the [i]-th point.
+     * @param i an index in [0,size()).
+     * @param p any point.
+     */
+    void setPoint( Size i, const Point & p );
+
+    /**
+     * @param k a coordinate in [0,dim).
+     * @return the column of the [k]-th coordinates of the points.
+     */
+    const Column & column( Dimension k ) const;
+
+    // ----------------------- Bulk operations --------------------------------
+  public:
+
+    /**
+     * Translates all the points.
+     * @param v any vector.
+     */
+    void translate( const Point & v );
+
+    /**
+     * Computes the bounding box of the points.
+     * @pre the buffer is not empty.
+     * @param[out] lower the lowest point of the bounding box.
+     * @param[out] upper the highest point of the bounding box.
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * Removes the points that are not in the box [lower,upper]. The
+     * order of the remaining points is kept.
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     */
+    void keepInside( const Point & lower, const Point & upper );
+
+    /**
+     * Removes the points that are not in the domain. The order of the
+     * remaining points is kept.
+     * @param domain any HyperRectDomain.
+     */
+    template <typename TDomain>
+    void keepInside( const TDomain & domain );
+
+    /**
+     * Computes the Morton key of each point relative to [origin], with
+     * the bit layout of Morton::interleaveBits (the bit i of coordinate
+     * k goes to the bit i*dim+k of the key).
+     *
+     * @pre all the points are upper [origin], and their coordinates
+     * relative to [origin] hold in sizeof(THashKey)*8/dim bits.
+     * @param[out] keys the vector of keys, of size size().
+     * @param origin the origin of the coordinates.
+     */
+    template <typename THashKey>
+    void mortonKeys( std::vector<THashKey> & keys, const Point & origin ) const;
+
+    /**
+     * Sorts the points in the lexicographic order of
+     * PointVector::operator< (first coordinate first).
+     */
+    void sort();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Comparator of point indices following the lexicographic order
+     * of the points.
+     */
+    struct IndexLess
+    {
+      IndexLess( const PointBuffer & buffer ) : myBuffer( &buffer ) {}
+      bool operator()( Size i, Size j ) const;
+      const PointBuffer* myBuffer;
+    };
+
+    /// The columns of coordinates.
+    boost::array<Column,dim> myColumns;
+
+  }; // end of class PointBuffer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PointBuffer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PointBuffer' to write.
+   * @return the output stream after the writing.
+   */
+  template <Dimension dim, typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PointBuffer<dim,TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/PointBuffer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointBuffer_h
+
+#undef PointBuffer_RECURSES
+#endif // else defined(PointBuffer_RECURSES)
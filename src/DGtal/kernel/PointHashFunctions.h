@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointHashFunctions.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Hash functors for PointVector, to be used in hash-based containers
+ * of points.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointHashFunctions_RECURSES)
+#error Recursive header files inclusion detected in PointHashFunctions.h
+#else // defined(PointHashFunctions_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointHashFunctions_RECURSES
+
+#if !defined PointHashFunctions_h
+/** Prevents repeated inclusion of headers. */
+#define PointHashFunctions_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/IntegerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Final mixing step of MurmurHash3 (64 bits). All bits of the input
+   * key affect all bits of the output, so that the low bits of the
+   * result can be used directly as an index in a power-of-two table.
+   *
+   * @param k any 64 bits key.
+   * @return the mixed key.
+   */
+  inline
+  DGtal::uint64_t mixHashKey64( DGtal::uint64_t k )
+  {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+  }
+
+  /**
+   * Description of template class 'PointHashMixer' <p> \brief Aim:
+   * Computes a 64 bits key from the coordinates of a point. The
+   * generic version combines the coordinates one after the other,
+   * while the specializations for dimensions 2 and 3 combine them
+   * with independent multipliers in a fixed number of operations.
+   *
+   * @tparam dim the dimension of the points.
+   */
+  template <DGtal::Dimension dim>
+  struct PointHashMixer
+  {
+    template <typename TPoint>
+    static inline
+    DGtal::uint64_t key( const TPoint & p )
+    {
+      typedef IntegerTraits<typename TPoint::Coordinate> Traits;
+      DGtal::uint64_t k = 0;
+      for ( DGtal::Dimension i = 0; i < dim; ++i )
+	k = ( k ^ static_cast<DGtal::uint64_t>( Traits::castToInt64_t( p[ i ] ) ) )
+	  * 0x100000001b3ULL;
+      return k;
+    }
+  };
+
+  /**
+   * Specialization of PointHashMixer for 2D points: the two
+   * coordinates are packed in a single 64 bits word, which is exact
+   * for coordinates fitting in 32 bits.
+   */
+  template <>
+  struct PointHashMixer<2>
+  {
+    template <typename TPoint>
+    static inline
+    DGtal::uint64_t key( const TPoint & p )
+    {
+      typedef IntegerTraits<typename TPoint::Coordinate> Traits;
+      return ( static_cast<DGtal::uint64_t>( Traits::castToInt64_t( p[ 0 ] ) ) << 32 )
+	^ static_cast<DGtal::uint64_t>( static_cast<DGtal::uint32_t>
+					( Traits::castToInt64_t( p[ 1 ] ) ) );
+    }
+  };
+
+  /**
+   * Specialization of PointHashMixer for 3D points.
+   */
+  template <>
+  struct PointHashMixer<3>
+  {
+    template <typename TPoint>
+    static inline
+    DGtal::uint64_t key( const TPoint & p )
+    {
+      typedef IntegerTraits<typename TPoint::Coordinate> Traits;
+      return static_cast<DGtal::uint64_t>( Traits::castToInt64_t( p[ 0 ] ) )
+	  * 0x9e3779b97f4a7c15ULL
+	^ static_cast<DGtal::uint64_t>( Traits::castToInt64_t( p[ 1 ] ) )
+	  * 0xc2b2ae3d27d4eb4fULL
+	^ static_cast<DGtal::uint64_t>( Traits::castToInt64_t( p[ 2 ] ) )
+	  * 0x165667b19e3779f9ULL;
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointHash
+  /**
+   * Description of template class 'PointHash' <p> \brief Aim: A hash
+   * functor for points (any PointVector), suitable for open
+   * addressing hash tables with power-of-two sizes.
+   *
+   * @code
+   * PointHash<Z3i::Point> h;
+   * std::size_t index = h( Z3i::Point( 1, 2, 3 ) ) & ( capacity - 1 );
+   * @endcode
+   *
+   * @tparam TPoint any PointVector whose coordinates can be cast to
+   * DGtal::int64_t by IntegerTraits.
+   */
+  template <typename TPoint>
+  struct PointHash
+  {
+    typedef TPoint Point;
+
+    inline
+    std::size_t operator()( const Point & p ) const
+    {
+      return static_cast<std::size_t>
+	( mixHashKey64( PointHashMixer<Point::dimension>::key( p ) ) );
+    }
+  };
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointHashFunctions_h
+
+#undef PointHashFunctions_RECURSES
+#endif // else defined(PointHashFunctions_RECURSES)
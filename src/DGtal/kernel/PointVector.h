@@ -209,6 +209,26 @@ namespace DGtal
     PointVector( const Self& apoint1, const Self& apoint2,
 		 const Functor& f );
 
+    /**
+     * Conversion constructor from a point with another type of
+     * coordinates, for instance from a 32-bit point to a 16-bit
+     * one. Each coordinate of [other] should be representable with
+     * Integer, which is checked in debug mode.
+     *
+     * @param other any point of the same dimension.
+     * @see isRepresentable
+     */
+    template <typename OtherInteger>
+    explicit PointVector( const PointVector<dim, OtherInteger> & other );
+
+    /**
+     * @param other any point of the same dimension.
+     * @return 'true' iff each coordinate of [other] is representable
+     * with Integer, i.e. the conversion constructor does not overflow.
+     */
+    template <typename OtherInteger>
+    static bool isRepresentable( const PointVector<dim, OtherInteger> & other );
+
     /**
      * Destructor.
      */
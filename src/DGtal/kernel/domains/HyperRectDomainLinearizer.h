@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HyperRectDomainLinearizer.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module HyperRectDomainLinearizer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HyperRectDomainLinearizer_RECURSES)
+#error Recursive header files inclusion detected in HyperRectDomainLinearizer.h
+#else // defined(HyperRectDomainLinearizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HyperRectDomainLinearizer_RECURSES
+
+#if !defined HyperRectDomainLinearizer_h
+/** Prevents repeated inclusion of headers. */
+#define HyperRectDomainLinearizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HyperRectDomainLinearizer
+  /**
+   * Description of template class 'HyperRectDomainLinearizer' <p>
+   * \brief Aim: Numbers the points of a HyperRectDomain in the order
+   * of the domain iterator (first coordinate varying fastest), so
+   * that any data on the domain can be stored in a flat array, like
+   * in ImageContainerBySTLVector.
+   *
+   * A displacement then becomes a fixed offset between indices, as
+   * long as both points are in the domain. The offsets of the
+   * neighbors of a MetricAdjacency are computed from its offsets()
+   * table. The algorithms working on a mask over the bounding box of
+   * an object (enlarged by one point, so that the neighbors of the
+   * points of the object are always in the mask) share this class.
+   *
+   * @code
+   * typedef HyperRectDomainLinearizer<Z3i::Domain> Linearizer;
+   * Linearizer lin( Linearizer::boundingBox( aSet, 1 ) );
+   * std::vector<unsigned char> mask;
+   * lin.rasterize( mask, aSet.begin(), aSet.end(),
+   *                (unsigned char) 1, (unsigned char) 0 );
+   * std::vector<Linearizer::Offset> offsets;
+   * lin.neighborOffsets<Z3i::Adj26>( offsets );
+   * @endcode
+   *
+   * @tparam TDomain any HyperRectDomain.
+   */
+  template <typename TDomain>
+  class HyperRectDomainLinearizer
+  {
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    /// The signed distance between the indices of two points.
+    typedef DGtal::int64_t Offset;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The domain is the default HyperRectDomain.
+     */
+    HyperRectDomainLinearizer();
+
+    /**
+     * Constructor.
+     * @param domain the numbered domain.
+     */
+    HyperRectDomainLinearizer( const Domain & domain );
+
+    /**
+     * Destructor.
+     */
+    ~HyperRectDomainLinearizer();
+
+    /**
+     * Numbers the points of another domain.
+     * @param domain the numbered domain.
+     */
+    void init( const Domain & domain );
+
+    /**
+     * @tparam TDigitalSet any model of CDigitalSet.
+     * @param aSet any non-empty digital set.
+     * @param margin the number of points added on each side.
+     * @return the bounding box of [aSet] enlarged by [margin].
+     */
+    template <typename TDigitalSet>
+    static Domain boundingBox( const TDigitalSet & aSet, Integer margin );
+
+    /// @return the numbered domain.
+    const Domain & domain() const;
+
+    /// @return the number of points of the domain.
+    Size size() const;
+
+    /**
+     * @param k any dimension.
+     * @return the index distance between consecutive points along
+     * axis [k].
+     */
+    Size stride( Dimension k ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of [p], in [0,size()).
+     */
+    Size index( const Point & p ) const;
+
+    /**
+     * @param d any displacement.
+     * @return the index distance from any point p to p + d.
+     */
+    Offset offset( const Vector & d ) const;
+
+    /**
+     * Writes the offsets of the displacements of a range.
+     *
+     * @tparam VectorIterator any iterator on vectors.
+     * @param b the begin of the displacements.
+     * @param e the end of the displacements.
+     * @param offsets (returns) the offsets, in the order of the range.
+     */
+    template <typename VectorIterator>
+    void offsets( VectorIterator b, VectorIterator e,
+		  std::vector<Offset> & offsets ) const;
+
+    /**
+     * Writes the offsets of the proper neighbors of a point.
+     *
+     * @tparam TAdjacency any MetricAdjacency.
+     * @param offsets (returns) the offsets, in the order of
+     * TAdjacency::offsets().
+     */
+    template <typename TAdjacency>
+    void neighborOffsets( std::vector<Offset> & offsets ) const;
+
+    /**
+     * Fills a mask over the domain: the points of a range that lie in
+     * the domain get the value [in], the other ones the value [out].
+     *
+     * @tparam TValue the type of the values of the mask.
+     * @tparam PointIterator any iterator on points.
+     * @param mask (returns) the mask, of size size().
+     * @param b the begin of the points.
+     * @param e the end of the points.
+     * @param in the value of the points of the range.
+     * @param out the value of the other points.
+     */
+    template <typename TValue, typename PointIterator>
+    void rasterize( std::vector<TValue> & mask,
+		    PointIterator b, PointIterator e,
+		    const TValue & in, const TValue & out ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The numbered domain.
+    Domain myDomain;
+    /// The index distance between consecutive points along each axis.
+    Size myStrides[ Domain::dimension ];
+    /// The number of points of the domain.
+    Size mySize;
+
+  }; // end of class HyperRectDomainLinearizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HyperRectDomainLinearizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HyperRectDomainLinearizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const HyperRectDomainLinearizer<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HyperRectDomainLinearizer_h
+
+#undef HyperRectDomainLinearizer_RECURSES
+#endif // else defined(HyperRectDomainLinearizer_RECURSES)
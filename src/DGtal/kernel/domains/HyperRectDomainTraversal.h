@@ -0,0 +1,383 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HyperRectDomainTraversal.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module HyperRectDomainTraversal.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HyperRectDomainTraversal_RECURSES)
+#error Recursive header files inclusion detected in HyperRectDomainTraversal.h
+#else // defined(HyperRectDomainTraversal_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HyperRectDomainTraversal_RECURSES
+
+#if !defined HyperRectDomainTraversal_h
+/** Prevents repeated inclusion of headers. */
+#define HyperRectDomainTraversal_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HyperRectDomainLoop
+  /**
+   * Description of template class 'HyperRectDomainLoop' <p> \brief
+   * Aim: Nested loops over the [k] first coordinates of a box, unrolled
+   * at compile time. HyperRectDomainLoop<k> loops over coordinate k-1
+   * and calls HyperRectDomainLoop<k-1> for each value, so that the
+   * first coordinate is the innermost loop, as with the domain
+   * iterator.
+   *
+   * This is the building block of HyperRectDomainTraversal. Each loop
+   * is a plain integer loop, without any carry test. It stops on the
+   * upper bound before incrementing, so that boxes reaching the
+   * largest value of the coordinate type are visited too.
+   *
+   * @tparam k the number of coordinates to loop over.
+   */
+  template <DGtal::Dimension k>
+  struct HyperRectDomainLoop
+  {
+    /**
+     * Calls [f]( p ) for each point p whose k first coordinates lie
+     * in [lower,upper] (the other coordinates are those of [p]).
+     *
+     * @param p the running point (modified).
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @param f any unary functor on points.
+     */
+    template <typename TPoint, typename TFunctor>
+    static void forEach( TPoint & p, const TPoint & lower, const TPoint & upper,
+			 TFunctor & f );
+
+    /**
+     * Calls [f]( p, n ) for each row of the box, p being the first
+     * point of the row and n the number of points of the row. Rows
+     * run along the first coordinate.
+     *
+     * @param p the running point (modified).
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @param length the number of points of each row.
+     * @param f any binary functor on (point, size).
+     */
+    template <typename TPoint, typename TSize, typename TFunctor>
+    static void forEachRow( TPoint & p, const TPoint & lower,
+			    const TPoint & upper, TSize length,
+			    TFunctor & f );
+  };
+
+  /**
+   * End of the compile time recursion for points: calls the functor.
+   */
+  template <>
+  struct HyperRectDomainLoop<0>
+  {
+    template <typename TPoint, typename TFunctor>
+    static void forEach( TPoint & p, const TPoint &, const TPoint &,
+			 TFunctor & f )
+    { f( p ); }
+  };
+
+  /**
+   * End of the compile time recursion for rows: the first coordinate
+   * is the row itself, so the functor is called once.
+   */
+  template <>
+  struct HyperRectDomainLoop<1>
+  {
+    template <typename TPoint, typename TFunctor>
+    static void forEach( TPoint & p, const TPoint & lower, const TPoint & upper,
+			 TFunctor & f )
+    {
+      if ( lower[ 0 ] > upper[ 0 ] ) return;
+      for ( p[ 0 ] = lower[ 0 ]; ; ++p[ 0 ] )
+	{
+	  f( p );
+	  if ( p[ 0 ] == upper[ 0 ] ) break;
+	}
+    }
+
+    template <typename TPoint, typename TSize, typename TFunctor>
+    static void forEachRow( TPoint & p, const TPoint & lower,
+			    const TPoint &, TSize length, TFunctor & f )
+    {
+      p[ 0 ] = lower[ 0 ];
+      f( p, length );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HyperRectDomainTraversal
+  /**
+   * Description of template class 'HyperRectDomainTraversal' <p>
+   * \brief Aim: Visits the points or the rows of a HyperRectDomain
+   * with nested loops unrolled at compile time over
+   * Point::dimension, instead of the carry tests performed by
+   * HyperRectDomain_Iterator at each increment.
+   *
+   * Points are visited in the same order as the domain iterator (first
+   * coordinate varying fastest). A row is a maximal segment of the
+   * domain along the first coordinate: visiting rows gives the inner
+   * loop to the caller as a plain integer loop.
+   *
+   * The domain can also be split into slabs along its last
+   * (outermost) coordinate, which are visited concurrently by
+   * parallelForEach and parallelSelect when DGtal is built with
+   * OpenMP (WITH_OPENMP). Otherwise these methods are serial.
+   *
+   * @code
+   * struct Counter {
+   *   Counter() : nb( 0 ) {}
+   *   void operator()( const Z3i::Point & p ) { ++nb; }
+   *   unsigned int nb;
+   * };
+   * Counter c = HyperRectDomainTraversal<Z3i::Domain>::forEach( domain, Counter() );
+   *
+   * typedef HyperRectDomainTraversal<Z3i::Domain>::ConstRowRange Rows;
+   * Rows rows( domain );
+   * for ( Rows::ConstIterator it = rows.begin(); it != rows.end(); ++it )
+   *   for ( Z3i::Domain::Size i = 0; i < it->length; ++i )
+   *     ... // point it->start + i * e_0
+   * @endcode
+   *
+   * @tparam TDomain any HyperRectDomain.
+   */
+  template <typename TDomain>
+  struct HyperRectDomainTraversal
+  {
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+
+    /**
+     * A row of the domain: its first point and its number of points.
+     */
+    struct Row
+    {
+      /// The first point of the row.
+      Point start;
+      /// The number of points of the row.
+      Size length;
+    };
+
+    /**
+     * Description of class 'ConstRowRange' <p> \brief Aim: range
+     * through the rows of a domain, in the order of the domain
+     * iterator. Incrementing the iterator costs one carry test per
+     * row instead of one per point.
+     */
+    class ConstRowRange
+    {
+    public:
+      /**
+       * Forward iterator on the rows of the domain.
+       */
+      class ConstIterator
+      {
+      public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef Row value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const Row* pointer;
+	typedef const Row& reference;
+
+	ConstIterator() : myLower(), myUpper(), myRow(), myEnd( true ) {}
+	ConstIterator( const Point & lower, const Point & upper, bool isEnd );
+	reference operator*() const { return myRow; }
+	pointer operator->() const { return &myRow; }
+	ConstIterator & operator++();
+	ConstIterator operator++( int )
+	{
+	  ConstIterator tmp( *this );
+	  ++( *this );
+	  return tmp;
+	}
+	bool operator==( const ConstIterator & other ) const;
+	bool operator!=( const ConstIterator & other ) const
+	{ return ! ( *this == other ); }
+
+      private:
+	/// The lowest point of the domain.
+	Point myLower;
+	/// The highest point of the domain.
+	Point myUpper;
+	/// The current row.
+	Row myRow;
+	/// 'true' iff the iterator is past the last row.
+	bool myEnd;
+      };
+
+      /**
+       * Constructor from a domain.
+       * @param domain any domain.
+       */
+      ConstRowRange( const Domain & domain );
+
+      /// @return an iterator on the first row.
+      ConstIterator begin() const;
+      /// @return an iterator after the last row.
+      ConstIterator end() const;
+      /// @return the number of rows of the domain.
+      Size size() const;
+      /// @return the number of points of each row.
+      Size rowLength() const;
+
+    private:
+      /// The lowest point of the domain.
+      Point myLower;
+      /// The highest point of the domain.
+      Point myUpper;
+    };
+
+    /**
+     * Calls [f]( p ) for each point p of the domain, in the order of
+     * the domain iterator.
+     *
+     * @param domain any domain.
+     * @param f any unary functor on points.
+     * @return the functor after the traversal (as std::for_each).
+     */
+    template <typename TFunctor>
+    static TFunctor forEach( const Domain & domain, TFunctor f );
+
+    /**
+     * Calls [f]( p, n ) for each row of the domain, p being the first
+     * point of the row and n its number of points.
+     *
+     * @param domain any domain.
+     * @param f any functor on (point, size).
+     * @return the functor after the traversal (as std::for_each).
+     */
+    template <typename TFunctor>
+    static TFunctor forEachRow( const Domain & domain, TFunctor f );
+
+    // ----------------------- Parallel services ------------------------------
+
+    /**
+     * @return the number of threads used when 0 is given as thread
+     * count (the OpenMP default, or 1 without OpenMP).
+     */
+    static unsigned int defaultNbThreads();
+
+    /**
+     * @param domain any non empty domain.
+     * @param nb the wished number of slabs.
+     * @return the number of slabs that [domain] can be split into, at
+     * most [nb] and at most the extent of the last coordinate.
+     */
+    static Size nbSlabs( const Domain & domain, Size nb );
+
+    /**
+     * Splits the domain into [nb] slabs of (almost) equal thickness
+     * along its last coordinate.
+     *
+     * @param domain any non empty domain.
+     * @param i the index of the slab, in [0,nb).
+     * @param nb the number of slabs, at most nbSlabs( domain, nb ).
+     * @return the i-th slab, as a domain.
+     */
+    static Domain slab( const Domain & domain, Size i, Size nb );
+
+    /**
+     * Calls [f]( p ) for each point p of the domain, the slabs of the
+     * domain being processed concurrently. Each slab is visited with
+     * its own copy of [f], so [f] should only act through side effects
+     * that are safe for distinct points (e.g. writing distinct cells
+     * of an array).
+     *
+     * @param domain any domain.
+     * @param f any unary functor on points.
+     * @param nbThreads the number of threads (0 means defaultNbThreads()).
+     */
+    template <typename TFunctor>
+    static void parallelForEach( const Domain & domain, const TFunctor & f,
+				 unsigned int nbThreads = 0 );
+
+    /**
+     * Appends to [points] the points p of the domain such that
+     * [pred]( p ) is true, in the order of the domain iterator. The
+     * predicate is evaluated concurrently on the slabs of the domain,
+     * then the selected points are concatenated.
+     *
+     * @param domain any domain.
+     * @param pred any predicate on points, whose const operator() is
+     * safe to call from several threads.
+     * @param[out] points the vector where the selected points are added.
+     * @param nbThreads the number of threads (0 means defaultNbThreads()).
+     */
+    template <typename TPredicate>
+    static void parallelSelect( const Domain & domain, const TPredicate & pred,
+				std::vector<Point> & points,
+				unsigned int nbThreads = 0 );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Functor appending to a vector the points satisfying a predicate.
+     */
+    template <typename TPredicate>
+    struct Selector
+    {
+      Selector( const TPredicate & pred, std::vector<Point> & points )
+	: myPred( &pred ), myPoints( &points ) {}
+      void operator()( const Point & p )
+      {
+	if ( (*myPred)( p ) ) myPoints->push_back( p );
+      }
+      const TPredicate* myPred;
+      std::vector<Point>* myPoints;
+    };
+
+  }; // end of struct HyperRectDomainTraversal
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HyperRectDomainTraversal_h
+
+#undef HyperRectDomainTraversal_RECURSES
+#endif // else defined(HyperRectDomainTraversal_RECURSES)
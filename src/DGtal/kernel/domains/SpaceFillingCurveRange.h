@@ -0,0 +1,316 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SpaceFillingCurveRange.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module SpaceFillingCurveRange.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SpaceFillingCurveRange_RECURSES)
+#error Recursive header files inclusion detected in SpaceFillingCurveRange.h
+#else // defined(SpaceFillingCurveRange_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SpaceFillingCurveRange_RECURSES
+
+#if !defined SpaceFillingCurveRange_h
+/** Prevents repeated inclusion of headers. */
+#define SpaceFillingCurveRange_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/Morton.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MortonCurve
+  /**
+   * Description of template class 'MortonCurve' <p> \brief Aim: The
+   * Morton (or Z-order) curve over the cube [0,2^order)^N, as a
+   * bijection between indices and points. It relies on the bit
+   * interleaving of class Morton.
+   *
+   * @tparam TPoint the type of points.
+   * @tparam THashKey an unsigned integer type holding N*order+1 bits.
+   */
+  template <typename TPoint, typename THashKey = DGtal::uint64_t>
+  class MortonCurve
+  {
+  public:
+    typedef TPoint Point;
+    typedef THashKey HashKey;
+    static const Dimension dimension = Point::dimension;
+
+    /**
+     * Constructor.
+     * @param order the number of bits of each coordinate.
+     */
+    MortonCurve( unsigned int order );
+
+    /// @return the number of bits of each coordinate.
+    unsigned int order() const;
+
+    /**
+     * @param p any point of [0,2^order)^N.
+     * @return the index of [p] along the curve.
+     */
+    HashKey index( const Point & p ) const;
+
+    /**
+     * @param h any index in [0,2^(N*order)).
+     * @param[out] p the point of index [h] along the curve.
+     */
+    void point( HashKey h, Point & p ) const;
+
+  private:
+    /// The bit interleaving.
+    Morton<HashKey,Point> myMorton;
+    /// The number of bits of each coordinate.
+    unsigned int myOrder;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HilbertCurve
+  /**
+   * Description of template class 'HilbertCurve' <p> \brief Aim: The
+   * Hilbert curve over the cube [0,2^order)^N, as a bijection between
+   * indices and points. Consecutive points along the curve are
+   * neighbors along one axis.
+   *
+   * The index is computed with the transposition method of
+   * J. Skilling (Programming the Hilbert curve, AIP Conf. Proc. 707,
+   * 2004): the point is transformed in place into the "transposed"
+   * index, whose bits are then interleaved with class Morton.
+   *
+   * @tparam TPoint the type of points.
+   * @tparam THashKey an unsigned integer type holding N*order+1 bits.
+   */
+  template <typename TPoint, typename THashKey = DGtal::uint64_t>
+  class HilbertCurve
+  {
+  public:
+    typedef TPoint Point;
+    typedef THashKey HashKey;
+    typedef typename Point::Coordinate Coordinate;
+    static const Dimension dimension = Point::dimension;
+
+    /**
+     * Constructor.
+     * @param order the number of bits of each coordinate.
+     */
+    HilbertCurve( unsigned int order );
+
+    /// @return the number of bits of each coordinate.
+    unsigned int order() const;
+
+    /**
+     * @param p any point of [0,2^order)^N.
+     * @return the index of [p] along the curve.
+     */
+    HashKey index( const Point & p ) const;
+
+    /**
+     * @param h any index in [0,2^(N*order)).
+     * @param[out] p the point of index [h] along the curve.
+     */
+    void point( HashKey h, Point & p ) const;
+
+  private:
+    /// The Morton curve used to (de)interleave the transposed index.
+    MortonCurve<Point,HashKey> myMorton;
+    /// The number of bits of each coordinate.
+    unsigned int myOrder;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SpaceFillingCurveRange
+  /**
+   * Description of template class 'SpaceFillingCurveRange' <p>
+   * \brief Aim: Range through the points of a HyperRectDomain in the
+   * order of a space-filling curve (MortonCurve or HilbertCurve),
+   * instead of the lexicographic order of HyperRectDomain::range().
+   * Points visited consecutively are close along all axes, which
+   * improves the locality of neighborhood-based algorithms, e.g. on
+   * an ImageContainerByHashTree whose keys follow the Morton order.
+   *
+   * The curve covers the smallest cube of side 2^order that contains
+   * the domain (translated at its lower bound). Indices of the cube
+   * falling outside the domain are skipped by whole aligned blocks,
+   * since the indices of a block of 2^(N*j) consecutive indices always
+   * fill an aligned cube of side 2^j.
+   *
+   * @code
+   * typedef SpaceFillingCurveRange< Z3i::Domain, HilbertCurve<Z3i::Point> > Range;
+   * Range range( domain );
+   * for ( Range::ConstIterator it = range.begin(); it != range.end(); ++it )
+   *   ... // *it is a point of domain
+   * @endcode
+   *
+   * @tparam TDomain any HyperRectDomain.
+   * @tparam TCurve a model of curve (MortonCurve or HilbertCurve),
+   * with an index type large enough for the domain.
+   */
+  template <typename TDomain, typename TCurve>
+  class SpaceFillingCurveRange
+  {
+  public:
+    typedef TDomain Domain;
+    typedef TCurve Curve;
+    typedef typename Domain::Point Point;
+    typedef typename Curve::HashKey HashKey;
+    static const Dimension dimension = Point::dimension;
+
+    /**
+     * Forward iterator on the points of the domain, in the order of
+     * the curve.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /**
+       * Constructor.
+       * @param range the range, which should outlive the iterator.
+       * @param h the index of the first point, or the end index.
+       */
+      ConstIterator( const SpaceFillingCurveRange & range, HashKey h );
+
+      reference operator*() const { return myPoint; }
+      pointer operator->() const { return &myPoint; }
+      ConstIterator & operator++();
+      ConstIterator operator++( int )
+      {
+	ConstIterator tmp( *this );
+	++( *this );
+	return tmp;
+      }
+      bool operator==( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+      bool operator!=( const ConstIterator & other ) const
+      { return myIndex != other.myIndex; }
+
+      /// @return the index of the current point along the curve.
+      HashKey index() const { return myIndex; }
+
+    private:
+      /**
+       * Moves forward to the first index at least myIndex that is a
+       * point of the domain, and updates myPoint.
+       */
+      void skipOutside();
+
+      /// The range.
+      const SpaceFillingCurveRange* myRange;
+      /// The current index along the curve.
+      HashKey myIndex;
+      /// The current point.
+      Point myPoint;
+    };
+
+    /**
+     * Constructor.
+     * @param domain any domain, whose size fits in the curve index.
+     * @pre dimension * order < number of bits of HashKey, where 2^order
+     * is the side of the cube containing the domain (e.g. extents
+     * below 2^21 in 3D with 64-bit indices).
+     */
+    SpaceFillingCurveRange( const Domain & domain );
+
+    /// @return an iterator on the first point of the curve.
+    ConstIterator begin() const;
+    /// @return an iterator after the last point of the curve.
+    ConstIterator end() const;
+
+    /// @return the curve.
+    const Curve & curve() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of [p] along the curve.
+     */
+    HashKey index( const Point & p ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param domain any domain.
+     * @return the number of bits necessary to code the largest extent
+     * of the domain (at least 1).
+     */
+    static unsigned int orderOf( const Domain & domain );
+
+    /// The lowest point of the domain.
+    Point myLower;
+    /// The domain upper bound, relative to myLower.
+    Point myExtent;
+    /// 'true' iff the domain is empty.
+    bool myEmpty;
+    /// The curve over the cube containing the domain.
+    Curve myCurve;
+    /// The index after the last index of the cube.
+    HashKey myEndIndex;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SpaceFillingCurveRange'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SpaceFillingCurveRange' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TCurve>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const SpaceFillingCurveRange<TDomain,TCurve> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/domains/SpaceFillingCurveRange.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SpaceFillingCurveRange_h
+
+#undef SpaceFillingCurveRange_RECURSES
+#endif // else defined(SpaceFillingCurveRange_RECURSES)
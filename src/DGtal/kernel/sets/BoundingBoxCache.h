@@ -0,0 +1,171 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BoundingBoxCache.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BoundingBoxCache.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BoundingBoxCache_RECURSES)
+#error Recursive header files inclusion detected in BoundingBoxCache.h
+#else // defined(BoundingBoxCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BoundingBoxCache_RECURSES
+
+#if !defined BoundingBoxCache_h
+/** Prevents repeated inclusion of headers. */
+#define BoundingBoxCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BoundingBoxCache
+  /**
+   * Description of template class 'BoundingBoxCache' <p> \brief Aim:
+   * Keeps the bounding box of a digital set up to date while the set
+   * is modified, so that the set can answer computeBoundingBox in
+   * constant time.
+   *
+   * Insertions extend the box. An erased point invalidates it only if
+   * it lies on the border of the box, since the box may then
+   * shrink. An invalid box is recomputed on the next query.
+   *
+   * The set owning the cache calls add() on insertion, remove() on
+   * erasure and invalidate() on any other modification. Its const
+   * bounding box query calls get( points, lower, upper ), which is
+   * safe when several OpenMP threads query the same set.
+   *
+   * @tparam TPoint the type of points.
+   */
+  template <typename TPoint>
+  class BoundingBoxCache
+  {
+  public:
+    typedef TPoint Point;
+    typedef typename Point::Dimension Dimension;
+    typedef typename std::vector<Point>::size_type Size;
+
+    /**
+     * Constructor. The box is invalid.
+     */
+    BoundingBoxCache();
+
+    /// @return 'true' iff the box is the bounding box of the set.
+    bool isValid() const;
+
+    /// The box should be recomputed on the next query.
+    void invalidate();
+
+    /**
+     * Updates the box after the insertion of [p].
+     * @param p the inserted point.
+     * @param wasEmpty 'true' iff the set was empty before the insertion.
+     */
+    void add( const Point & p, bool wasEmpty );
+
+    /**
+     * Updates the box before the erasure of [p].
+     * @param p the erased point.
+     */
+    void remove( const Point & p );
+
+    /**
+     * Recomputes the box from a range of points, which should not be
+     * empty.
+     * @param first an iterator on the first point.
+     * @param last an iterator after the last point.
+     */
+    template <typename TConstIterator>
+    void compute( TConstIterator first, TConstIterator last );
+
+    /**
+     * Recomputes the box from a non empty vector of points. The vector
+     * is split into chunks processed concurrently when DGtal is built
+     * with OpenMP.
+     * @param points a non empty vector of points.
+     */
+    void compute( const std::vector<Point> & points );
+
+    /**
+     * Recomputes the box from a non empty container of points.
+     * @param points a non empty container of points.
+     */
+    template <typename TContainer>
+    void compute( const TContainer & points );
+
+    /**
+     * @param[out] lower the lowest point of the box.
+     * @param[out] upper the highest point of the box.
+     * @pre isValid()
+     */
+    void get( Point & lower, Point & upper ) const;
+
+    /**
+     * Gives the box, recomputing it first from [points] if it is
+     * invalid. Concurrent calls are serialized, so that threads may
+     * query the bounding box of a shared set.
+     *
+     * @param points the non empty container of the points of the set.
+     * @param[out] lower the lowest point of the box.
+     * @param[out] upper the highest point of the box.
+     */
+    template <typename TContainer>
+    void get( const TContainer & points, Point & lower, Point & upper );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The lowest point of the box.
+    Point myLower;
+    /// The highest point of the box.
+    Point myUpper;
+    /// 'true' iff the box is the bounding box of the set.
+    bool myIsValid;
+
+  }; // end of class BoundingBoxCache
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/BoundingBoxCache.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BoundingBoxCache_h
+
+#undef BoundingBoxCache_RECURSES
+#endif // else defined(BoundingBoxCache_RECURSES)
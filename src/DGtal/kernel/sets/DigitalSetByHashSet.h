@@ -0,0 +1,554 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByHashSet.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DigitalSetByHashSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByHashSet_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByHashSet.h
+#else // defined(DigitalSetByHashSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByHashSet_RECURSES
+
+#if !defined DigitalSetByHashSet_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByHashSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+#ifdef WITH_VISU3D_QGLVIEWER
+#include "DGtal/io-viewers/3dViewers/DGtalQGLViewer.h"
+#endif
+
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByHashSet
+  /**
+   * Description of template class 'DigitalSetByHashSet' <p> \brief
+   * Aim: Realizes the concept CDigitalSet by using an open addressing
+   * hash table of points.
+   *
+   * Points are stored in a power-of-two array of slots with linear
+   * probing. Membership tests, insertions and removals are O(1) on
+   * average, and only compare the few points that share a cluster of
+   * the table. Removals leave a tombstone in the slot, which is reused
+   * by later insertions and dropped when the table is rehashed. The
+   * table grows automatically, but can also be sized once with
+   * reserve() before a bulk insertion.
+   *
+   * The iteration order is unspecified. Insertions invalidate
+   * iterators, while a removal only invalidates the iterators on the
+   * removed point, so that the set may be traversed while erasing.
+   *
+   * @tparam TDomain a realization of the concept CDomain.
+   * @tparam THash the hash functor of points (default is PointHash).
+   * @see CDigitalSet,CDomain,PointHash
+   */
+  template <typename TDomain,
+	    typename THash = PointHash<typename TDomain::Point> >
+  class DigitalSetByHashSet
+  {
+  public:
+    typedef TDomain Domain;
+    typedef THash Hash;
+    typedef DigitalSetByHashSet<Domain, Hash> Self;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+
+    /// The states of the slots of the table.
+    enum SlotState { EMPTY_SLOT = 0, USED_SLOT = 1, ERASED_SLOT = 2 };
+
+    /**
+     * Read-only forward iterator on the occupied slots of the table.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      ConstIterator() : myPoint( 0 ), myUsed( 0 ), myUsedEnd( 0 ) {}
+      ConstIterator( const Point* point, const unsigned char* used,
+		     const unsigned char* usedEnd )
+	: myPoint( point ), myUsed( used ), myUsedEnd( usedEnd )
+      {
+	skipEmpty();
+      }
+      reference operator*() const { return *myPoint; }
+      pointer operator->() const { return myPoint; }
+      ConstIterator & operator++()
+      {
+	++myPoint; ++myUsed;
+	skipEmpty();
+	return *this;
+      }
+      ConstIterator operator++( int )
+      {
+	ConstIterator tmp( *this );
+	++( *this );
+	return tmp;
+      }
+      bool operator==( const ConstIterator & other ) const
+      { return myUsed == other.myUsed; }
+      bool operator!=( const ConstIterator & other ) const
+      { return myUsed != other.myUsed; }
+
+    private:
+      friend class DigitalSetByHashSet<TDomain, THash>;
+      void skipEmpty()
+      {
+	while ( ( myUsed != myUsedEnd ) && ( *myUsed != USED_SLOT ) )
+	  { ++myPoint; ++myUsed; }
+      }
+      /// Pointer on the current slot.
+      const Point* myPoint;
+      /// Pointer on the state of the current slot.
+      const unsigned char* myUsed;
+      /// Pointer after the last state.
+      const unsigned char* myUsedEnd;
+    };
+    /// Iterators are read-only since points are placed by their hash.
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByHashSet();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByHashSet( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByHashSet ( const DigitalSetByHashSet & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByHashSet & operator= ( const DigitalSetByHashSet & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. When the iterators are at least forward iterators,
+     * the table is sized once for the whole collection.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set. There is no defined behavior if the point is already in
+     * the set (for instance, may be present twice).
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The collection should contain distinct points. Each
+     * of these points should also not belong already to the set.
+     * There is no defined behavior if the preceding requisites
+     * are not satisfied.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set. The other
+     * iterators remain valid, so that 'erase( it++ )' may be used
+     * during a traversal.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set. The capacity of the table is kept.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * Sizes the table so that [n] points can be stored without any
+     * further reallocation.
+     *
+     * @param n the expected number of points.
+     */
+    void reserve( Size n );
+
+    /**
+     * @return the number of slots of the table.
+     */
+    Size capacity() const;
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    Self & operator+= ( const Self & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     */
+    Self & operator-= ( const Self & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    Self & operator*= ( const Self & aSet );
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * @return the complement of this set in the domain.
+     *
+     * NB: be aware of the overhead cost when returning the object.
+     */
+    Self computeComplement() const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * The hash functor.
+     */
+    Hash myHash;
+
+    /**
+     * The slots of the table (size is a power of two or zero).
+     */
+    std::vector<Point> mySlots;
+
+    /**
+     * The states of the slots (see SlotState).
+     */
+    std::vector<unsigned char> myUsed;
+
+    /**
+     * The number of points in the set.
+     */
+    Size mySize;
+
+    /**
+     * The number of tombstones (ERASED_SLOT) in the table.
+     */
+    Size myNbErased;
+
+  public:
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyle : public DrawableWithDGtalBoard
+    {
+      virtual void selfDraw(DGtalBoard & aBoard) const
+      {
+	aBoard.setFillColorRGBi(160,160,160);
+	aBoard.setPenColorRGBi(80,80,80);
+      }
+    };
+
+    // --------------- CDrawableWithDGtalBoard realization --------------------
+  public:
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithDGtalBoard* defaultStyle( std::string mode = "" ) const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string styleName() const;
+
+    /**
+     * Draw the object on a DGtalBoard board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDraw(DGtalBoard & board ) const;
+
+
+
+#ifdef WITH_VISU3D_QGLVIEWER
+
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyleQGL : public  DrawableWithDGtalQGLViewer
+    {
+       virtual void selfDrawQGL(DGtalQGLViewer & viewer) const
+        {
+	  viewer.myModes[ "DigitalSetByHashSet" ] = "";
+	}
+
+    };
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithDGtalQGLViewer* defaultStyleQGL( std::string mode = "" ) const;
+
+    /**
+     * Draw the object on a DGtalBoard board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDrawQGL(  DGtalQGLViewer & viewer ) const;
+    void selfDrawAsGridQGL( DGtalQGLViewer & viewer  ) const;
+    void selfDrawAsPavingQGL( DGtalQGLViewer & viewer ) const;
+    void selfDrawAsPavingTransparentQGL( DGtalQGLViewer & viewer ) const;
+
+#endif
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByHashSet();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any digital point.
+     * @return the index of the slot containing [p] or, if [p] is not
+     * in the set, the index of the first empty or erased slot where it
+     * would be inserted.
+     * @pre the table is not empty.
+     */
+    Size slotOf( const Point & p ) const;
+
+    /**
+     * Removes the point stored in slot [i], leaving a tombstone.
+     *
+     * @param i the index of an occupied slot.
+     */
+    void eraseSlot( Size i );
+
+    /**
+     * Reallocates the table with [capacity] slots and inserts back
+     * all the points.
+     *
+     * @param capacity the new number of slots (a power of two).
+     */
+    void rehash( Size capacity );
+
+    /**
+     * Grows the table if it cannot receive [n] points while keeping
+     * its load factor below its maximal value. The tombstones count
+     * in the load factor, and are dropped if the table is rehashed.
+     *
+     * @param n the number of points the table should hold.
+     */
+    void prepare( Size n );
+
+    /**
+     * Inserts the range of points, sizing the table first (forward
+     * iterators).
+     */
+    template <typename PointIterator>
+    void insertRange( PointIterator first, PointIterator last,
+		      std::forward_iterator_tag );
+
+    /**
+     * Inserts the range of points one by one (input iterators).
+     */
+    template <typename PointIterator>
+    void insertRange( PointIterator first, PointIterator last,
+		      std::input_iterator_tag );
+
+  }; // end of class DigitalSetByHashSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByHashSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByHashSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain, typename Hash>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const DigitalSetByHashSet<Domain, Hash> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByHashSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByHashSet_h
+
+#undef DigitalSetByHashSet_RECURSES
+#endif // else defined(DigitalSetByHashSet_RECURSES)
@@ -0,0 +1,575 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DigitalSetByRuns.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
+//////////////////////////////////////////////////////////////////////////////
+#ifdef WITH_VISU3D_QGLVIEWER
+#include "DGtal/io-viewers/3dViewers/DGtalQGLViewer.h"
+#endif
+
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+   * Description of template class 'DigitalSetByRuns' <p> \brief
+   * Aim: Realizes the concept CDigitalSet by storing the set as runs
+   * (intervals) of consecutive points along the first axis.
+   *
+   * A row is the set of points sharing all their coordinates except
+   * the first one (a (y,z) row in 3D). Each row of the set is stored as
+   * a sorted list of disjoint and non adjacent X intervals. All runs
+   * are kept in a single vector, sorted by row (last coordinate most
+   * significant) then by X. The memory is thus proportional to the
+   * number of runs, which is much smaller than the number of points for
+   * big volumetric objects.
+   *
+   * Membership tests are binary searches in the runs (O(log r)).
+   * Iteration streams the points in the order of the domain iterator
+   * (first coordinate varying fastest). Union, difference and
+   * intersection are computed run by run in O(r), and the complement
+   * in O(r + number of rows of the domain). Single point insertions
+   * and removals may shift the end of the runs vector.
+   *
+   * @tparam TDomain a realization of the concept CDomain.
+   * @see CDigitalSet,CDomain
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRuns<Domain> Self;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+
+    /**
+     * A run of points: the points between [first] and the point of
+     * the same row with first coordinate [last].
+     */
+    struct Run
+    {
+      /// The first point of the run.
+      Point first;
+      /// The first coordinate of the last point of the run.
+      Coordinate last;
+
+      Run() {}
+      Run( const Point & aFirst, Coordinate aLast )
+	: first( aFirst ), last( aLast ) {}
+      /// @return the number of points of the run.
+      Size size() const { return (Size) ( last - first[ 0 ] + 1 ); }
+    };
+    typedef std::vector<Run> Runs;
+
+    /**
+     * Read-only forward iterator on the points of the set, visiting
+     * the runs one after the other.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      ConstIterator() {}
+      ConstIterator( typename Runs::const_iterator run,
+		     typename Runs::const_iterator runEnd,
+		     const Point & point )
+	: myRun( run ), myRunEnd( runEnd ), myPoint( point ) {}
+      reference operator*() const { return myPoint; }
+      pointer operator->() const { return &myPoint; }
+      ConstIterator & operator++()
+      {
+	if ( myPoint[ 0 ] < myRun->last )
+	  ++myPoint[ 0 ];
+	else
+	  {
+	    ++myRun;
+	    myPoint = ( myRun != myRunEnd ) ? myRun->first : Point();
+	  }
+	return *this;
+      }
+      ConstIterator operator++( int )
+      {
+	ConstIterator tmp( *this );
+	++( *this );
+	return tmp;
+      }
+      bool operator==( const ConstIterator & other ) const
+      { return ( myRun == other.myRun ) && ( myPoint[ 0 ] == other.myPoint[ 0 ] ); }
+      bool operator!=( const ConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// The current run.
+      typename Runs::const_iterator myRun;
+      /// The run after the last one.
+      typename Runs::const_iterator myRunEnd;
+      /// The current point (the origin after the last run).
+      Point myPoint;
+    };
+    /// Iterators are read-only since points are not stored individually.
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set. The point extends or merges the runs
+     * of its row when it is adjacent to them.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The points are sorted and gathered into runs, which
+     * are then merged with the runs of the set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set. The run containing [p] may be
+     * shortened or split.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     * NB: binary search in the runs.
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left, computed run by run.
+     * @param aSet any other set.
+     */
+    Self & operator+= ( const Self & aSet );
+
+    /**
+     * set difference to left, computed run by run.
+     * @param aSet any other set.
+     */
+    Self & operator-= ( const Self & aSet );
+
+    /**
+     * set intersection to left, computed run by run.
+     * @param aSet any other set.
+     */
+    Self & operator*= ( const Self & aSet );
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * @return the number of runs of the set.
+     */
+    Size nbRuns() const;
+
+    /**
+     * @return the runs of the set, sorted by row then by first
+     * coordinate.
+     */
+    const Runs & runs() const;
+
+    /**
+     * @return the complement of this set in the domain.
+     *
+     * NB: be aware of the overhead cost when returning the object.
+     */
+    Self computeComplement() const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this. Each row of the domain is filled with the gaps between the
+     * runs of [other_set], so that the cost depends on the number of
+     * rows and runs, not on the number of points.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the runs are sorted, disjoint and non adjacent,
+     * and if their sizes sum up to size(), 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * The runs of the set, sorted by row then by first coordinate.
+     */
+    Runs myRuns;
+
+    /**
+     * The number of points in the set.
+     */
+    Size mySize;
+
+  public:
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyle : public DrawableWithDGtalBoard
+    {
+      virtual void selfDraw(DGtalBoard & aBoard) const
+      {
+	aBoard.setFillColorRGBi(160,160,160);
+	aBoard.setPenColorRGBi(80,80,80);
+      }
+    };
+
+    // --------------- CDrawableWithDGtalBoard realization --------------------
+  public:
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithDGtalBoard* defaultStyle( std::string mode = "" ) const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string styleName() const;
+
+    /**
+     * Draw the object on a DGtalBoard board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDraw(DGtalBoard & board ) const;
+
+
+
+#ifdef WITH_VISU3D_QGLVIEWER
+
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyleQGL : public  DrawableWithDGtalQGLViewer
+    {
+       virtual void selfDrawQGL(DGtalQGLViewer & viewer) const
+        {
+	  viewer.myModes[ "DigitalSetByRuns" ] = "";
+	}
+
+    };
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithDGtalQGLViewer* defaultStyleQGL( std::string mode = "" ) const;
+
+    /**
+     * Draw the object on a DGtalBoard board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDrawQGL(  DGtalQGLViewer & viewer ) const;
+    void selfDrawAsGridQGL( DGtalQGLViewer & viewer  ) const;
+    void selfDrawAsPavingQGL( DGtalQGLViewer & viewer ) const;
+    void selfDrawAsPavingTransparentQGL( DGtalQGLViewer & viewer ) const;
+
+#endif
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Order of the runs: compares points from the last coordinate to
+     * the first one.
+     */
+    struct RunOrder
+    {
+      bool operator()( const Point & p1, const Point & p2 ) const;
+      bool operator()( const Point & p, const Run & r ) const;
+      bool operator()( const Run & r, const Point & p ) const;
+    };
+
+    /**
+     * @param p1 any point.
+     * @param p2 any point.
+     * @return 'true' iff [p1] and [p2] lie on the same row.
+     */
+    static bool sameRow( const Point & p1, const Point & p2 );
+
+    /**
+     * @param p any point.
+     * @return an iterator on the first run starting after [p] (in the
+     * order of the runs).
+     */
+    typename Runs::iterator upperRun( const Point & p );
+
+    /**
+     * Computes the union of two sorted lists of runs.
+     *
+     * @param runs1 any sorted list of runs.
+     * @param runs2 any sorted list of runs.
+     * @param[out] result the sorted list of runs of the union.
+     * @return the number of points of the union.
+     */
+    static Size unionOfRuns( const Runs & runs1, const Runs & runs2,
+			     Runs & result );
+
+    /**
+     * Computes the difference of two sorted lists of runs.
+     *
+     * @param runs1 any sorted list of runs.
+     * @param runs2 any sorted list of runs.
+     * @param[out] result the sorted list of runs of [runs1] minus [runs2].
+     * @return the number of points of the difference.
+     */
+    static Size differenceOfRuns( const Runs & runs1, const Runs & runs2,
+				  Runs & result );
+
+    /**
+     * Computes the intersection of two sorted lists of runs.
+     *
+     * @param runs1 any sorted list of runs.
+     * @param runs2 any sorted list of runs.
+     * @param[out] result the sorted list of runs of the intersection.
+     * @return the number of points of the intersection.
+     */
+    static Size intersectionOfRuns( const Runs & runs1, const Runs & runs2,
+				    Runs & result );
+
+    /**
+     * @param p1 any point.
+     * @param p2 any point.
+     * @return 'true' iff the row of [p1] is before the row of [p2].
+     */
+    static bool rowBefore( const Point & p1, const Point & p2 );
+
+    /**
+     * @param runs any list of runs.
+     * @return the number of points of the runs.
+     */
+    static Size sizeOfRuns( const Runs & runs );
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
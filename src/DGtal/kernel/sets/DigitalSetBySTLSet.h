@@ -48,6 +48,7 @@
 #include <set>
 #include <string>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/sets/BoundingBoxCache.h"
 //////////////////////////////////////////////////////////////////////////////
 
 #ifdef WITH_VISU3D_QGLVIEWER
@@ -232,6 +233,20 @@ namespace DGtal
     DigitalSetBySTLSet<Domain> & operator+=
     ( const DigitalSetBySTLSet<Domain> & aSet );
 
+    /**
+     * set difference to left (linear merge of the two sorted sets).
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLSet<Domain> & operator-=
+    ( const DigitalSetBySTLSet<Domain> & aSet );
+
+    /**
+     * set intersection to left (linear merge of the two sorted sets).
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLSet<Domain> & operator*=
+    ( const DigitalSetBySTLSet<Domain> & aSet );
+
     // ----------------------- Other Set services -----------------------------
   public:
     
@@ -244,14 +259,23 @@ namespace DGtal
 
     /**
      * Builds the complement in the domain of the set [other_set] in
-     * this.
+     * this. The domain is scanned once in the order of the points and
+     * merged with [other_set], so the cost is linear.
      *
      * @param other_set defines the set whose complement is assigned to 'this'.
      */
     void assignFromComplement( const DigitalSetBySTLSet<Domain> & other_set ); 
     
     /**
-     * Computes the bounding box of this set.
+     * Computes the bounding box of this set. The box is maintained
+     * while points are inserted, so that this query is in O(1). It is
+     * recomputed here only after the erasure of a point lying on its
+     * border or after a set operation that may shrink it. Since it
+     * updates a cache, this method should not be called concurrently
+     * on the same set.
+     *
+     * If the set is empty, [lower] is the upper bound of the domain
+     * and [upper] its lower bound.
      *
      * @param lower the first point of the bounding box (lowest in all
      * directions).
@@ -289,6 +313,12 @@ namespace DGtal
      */
     std::set<Point> mySet;
 
+    /**
+     * The bounding box of the points of the set, updated by the
+     * modifiers of the set and lazily recomputed by computeBoundingBox.
+     */
+    mutable BoundingBoxCache<Point> myBoundingBox;
+
 
   public:
     /** 
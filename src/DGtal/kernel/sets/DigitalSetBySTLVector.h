@@ -48,6 +48,7 @@
 #include <vector>
 #include <string>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/sets/BoundingBoxCache.h"
 //////////////////////////////////////////////////////////////////////////////
 #ifdef WITH_VISU3D_QGLVIEWER
 #include "DGtal/io-viewers/3dViewers/DGtalQGLViewer.h"
@@ -67,6 +68,9 @@ namespace DGtal
    * It thus describes a modifiable set of points within the given
    * domain [Domain].
    *
+   * The points should not be modified through an Iterator, since the
+   * set could not update its bounding box.
+   *
    * @tparam Domain a realization of the concept CDomain.
    * @see CDigitalSet,CDomain
    */
@@ -217,6 +221,8 @@ namespace DGtal
     /**
      * @param p any digital point.
      * @return an iterator pointing on [p] if found, otherwise end().
+     * The set should only be modified through its own services
+     * (insert, erase, clear, assignment), which keep the bounding box.
      */
     Iterator find( const Point & p );
 
@@ -232,6 +238,7 @@ namespace DGtal
 
     /**
      * @return an iterator on the first element in this set.
+     * As for find(), the points should not be modified through it.
      */
     Iterator begin();
 
@@ -247,6 +254,22 @@ namespace DGtal
     DigitalSetBySTLVector<Domain> & operator+=
     ( const DigitalSetBySTLVector<Domain> & aSet );
 
+    /**
+     * set difference to left. Both sets are sorted, then merged in
+     * linear time (like operator+=).
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLVector<Domain> & operator-=
+    ( const DigitalSetBySTLVector<Domain> & aSet );
+
+    /**
+     * set intersection to left. Both sets are sorted, then merged in
+     * linear time (like operator+=).
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLVector<Domain> & operator*=
+    ( const DigitalSetBySTLVector<Domain> & aSet );
+
     // ----------------------- Other Set services -----------------------------
   public:
     
@@ -259,14 +282,23 @@ namespace DGtal
 
     /**
      * Builds the complement in the domain of the set [other_set] in
-     * this.
+     * this. The points of [other_set] are sorted once, then merged
+     * with a scan of the domain in the same order.
      *
      * @param other_set defines the set whose complement is assigned to 'this'.
      */
     void assignFromComplement( const DigitalSetBySTLVector<Domain> & other_set ); 
     
     /**
-     * Computes the bounding box of this set.
+     * Computes the bounding box of this set. The box is maintained
+     * while points are inserted, so that this query is in O(1). It is
+     * recomputed here only after the erasure of a point lying on its
+     * border or after a set operation that may shrink it. Since it
+     * updates a cache, this method should not be called concurrently
+     * on the same set.
+     *
+     * If the set is empty, [lower] is the upper bound of the domain
+     * and [upper] its lower bound.
      *
      * @param lower the first point of the bounding box (lowest in all
      * directions).
@@ -303,6 +335,12 @@ namespace DGtal
      */
     std::vector<Point> myVector;
 
+    /**
+     * The bounding box of the points of the set, updated by the
+     * modifiers of the set and lazily recomputed by computeBoundingBox.
+     */
+    mutable BoundingBoxCache<Point> myBoundingBox;
+
     // ------------------------- Private Datas --------------------------------
   private:
 
@@ -0,0 +1,442 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetBySortedSTLVector.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DigitalSetBySortedSTLVector.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetBySortedSTLVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetBySortedSTLVector.h
+#else // defined(DigitalSetBySortedSTLVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetBySortedSTLVector_RECURSES
+
+#if !defined DigitalSetBySortedSTLVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetBySortedSTLVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+#ifdef WITH_VISU3D_QGLVIEWER
+#include "DGtal/io-viewers/3dViewers/DGtalQGLViewer.h"
+#endif
+
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetBySortedSTLVector
+  /**
+   * Description of template class 'DigitalSetBySortedSTLVector' <p>
+   * \brief Aim: Realizes the concept CDigitalSet by using the STL
+   * container std::vector, whose points are kept sorted.
+   *
+   * Points are stored in increasing order for Point::operator<
+   * (lexicographic order starting from dimension 0), which is also the
+   * order of DigitalSetBySTLSet. Membership tests are thus binary
+   * searches (O(log n)), while iteration is a contiguous scan of
+   * memory. Batched insertions append the new points, sort them and
+   * merge them with the already stored ones. Set union, intersection
+   * and difference with another sorted set are linear merges.
+   *
+   * This representation is well adapted to medium-size sets that are
+   * built once (preferably with the batched insert) and queried many
+   * times. Single point insertions and removals are O(n) since they
+   * shift the end of the vector.
+   *
+   * @tparam TDomain a realization of the concept CDomain.
+   * @see CDigitalSet,CDomain,DigitalSetBySTLVector
+   */
+  template <typename TDomain>
+  class DigitalSetBySortedSTLVector
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetBySortedSTLVector<Domain> Self;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    /// Iterators are read-only to preserve the order of the points.
+    typedef typename std::vector<Point>::const_iterator Iterator;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetBySortedSTLVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetBySortedSTLVector( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetBySortedSTLVector ( const DigitalSetBySortedSTLVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetBySortedSTLVector & operator=
+    ( const DigitalSetBySortedSTLVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The points are appended, sorted, then merged with the
+     * points already in the set. Duplicates are removed.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set. There is no defined behavior if the point is already in
+     * the set.
+     *
+     * NB: O(1) when points are inserted in increasing order.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The collection should contain distinct points. Each
+     * of these points should also not belong already to the set.
+     * There is no defined behavior if the preceding requisites
+     * are not satisfied.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * Requests that the capacity of the container be at least [n]
+     * points.
+     *
+     * @param n the expected number of points.
+     */
+    void reserve( Size n );
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     * NB: binary search, O(log n).
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left (linear merge).
+     * @param aSet any other set.
+     */
+    Self & operator+= ( const Self & aSet );
+
+    /**
+     * set difference to left (linear merge).
+     * @param aSet any other set.
+     */
+    Self & operator-= ( const Self & aSet );
+
+    /**
+     * set intersection to left (linear merge).
+     * @param aSet any other set.
+     */
+    Self & operator*= ( const Self & aSet );
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * @return the complement of this set in the domain.
+     *
+     * NB: be aware of the overhead cost when returning the object.
+     */
+    Self computeComplement() const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this. The domain is scanned once in the order of the points, so
+     * that the complement is computed by a single linear merge.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the points are stored in strictly increasing
+     * order, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * The container storing the points of the set, in increasing order.
+     */
+    std::vector<Point> myVector;
+
+  public:
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyle : public DrawableWithDGtalBoard
+    {
+      virtual void selfDraw(DGtalBoard & aBoard) const
+      {
+	aBoard.setFillColorRGBi(160,160,160);
+	aBoard.setPenColorRGBi(80,80,80);
+      }
+    };
+
+    // --------------- CDrawableWithDGtalBoard realization --------------------
+  public:
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithDGtalBoard* defaultStyle( std::string mode = "" ) const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string styleName() const;
+
+    /**
+     * Draw the object on a DGtalBoard board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDraw(DGtalBoard & board ) const;
+
+
+
+#ifdef WITH_VISU3D_QGLVIEWER
+
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyleQGL : public  DrawableWithDGtalQGLViewer
+    {
+       virtual void selfDrawQGL(DGtalQGLViewer & viewer) const
+        {
+	  viewer.myModes[ "DigitalSetBySortedSTLVector" ] = "";
+	}
+
+    };
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithDGtalQGLViewer* defaultStyleQGL( std::string mode = "" ) const;
+
+    /**
+     * Draw the object on a DGtalBoard board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDrawQGL(  DGtalQGLViewer & viewer ) const;
+    void selfDrawAsGridQGL( DGtalQGLViewer & viewer  ) const;
+    void selfDrawAsPavingQGL( DGtalQGLViewer & viewer ) const;
+    void selfDrawAsPavingTransparentQGL( DGtalQGLViewer & viewer ) const;
+
+#endif
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetBySortedSTLVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param it any const iterator on myVector.
+     * @return the corresponding mutable iterator.
+     */
+    typename std::vector<Point>::iterator unconst( ConstIterator it );
+
+    /**
+     * Restores the invariant after points have been appended at the
+     * end of myVector: the points from position [nb_sorted] are
+     * sorted, merged with the first ones, and duplicates are removed.
+     *
+     * @param nb_sorted the number of points at the beginning of
+     * myVector that are already sorted.
+     */
+    void mergeTail( Size nb_sorted );
+
+  }; // end of class DigitalSetBySortedSTLVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetBySortedSTLVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetBySortedSTLVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const DigitalSetBySortedSTLVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetBySortedSTLVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetBySortedSTLVector_h
+
+#undef DigitalSetBySortedSTLVector_RECURSES
+#endif // else defined(DigitalSetBySortedSTLVector_RECURSES)
@@ -48,6 +48,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetBySortedSTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByHashSet.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -0,0 +1,228 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BorderExtractor.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BorderExtractor.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BorderExtractor_RECURSES)
+#error Recursive header files inclusion detected in BorderExtractor.h
+#else // defined(BorderExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BorderExtractor_RECURSES
+
+#if !defined BorderExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define BorderExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/topology/MetricAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BorderExtractor
+  /**
+   * Description of template class 'BorderExtractor' <p> \brief Aim:
+   * Computes the border of a digital object, i.e. its points that are
+   * lambda-adjacent to a point of the domain outside the object, by a
+   * linear scan of a mask.
+   *
+   * The object is rasterized once in a byte mask over its bounding
+   * box enlarged by one point, the points outside the domain of the
+   * object being marked so that they are not counted as
+   * background. The neighbors of a point are then read in the mask at
+   * fixed linear offsets. The bounding box is scanned by slabs, which
+   * are processed concurrently when OpenMP is available, and the
+   * border points are given in the order of the domain iterator.
+   *
+   * The offsets are the ones of the neighborhood of the origin, hence
+   * the background adjacency should be a MetricAdjacency, as tells
+   * the constant [available]. Since the mask covers the bounding box,
+   * this class is meant for objects that fill a reasonable part of
+   * their bounding box.
+   *
+   * @code
+   * BorderExtractor<Z3i::Object6_18> extractor( object );
+   * borderSet.insertNew( extractor.begin(), extractor.end() );
+   * @endcode
+   *
+   * @tparam TObject the type of object, a specialization of Object.
+   * @see Object::border
+   */
+  template <typename TObject>
+  class BorderExtractor
+  {
+  public:
+    typedef TObject Object;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename Object::Space Space;
+    typedef typename Object::BackgroundAdjacency BackgroundAdjacency;
+    typedef HyperRectDomain<Space> Domain;
+    typedef HyperRectDomainTraversal<Domain> Traversal;
+    typedef HyperRectDomainLinearizer<Domain> Linearizer;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    /// 'true' iff the background adjacency is a MetricAdjacency.
+    static const bool available =
+      IsMetricAdjacency<BackgroundAdjacency>::value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the border of [object].
+     *
+     * @param object any object whose background adjacency is a
+     * MetricAdjacency.
+     * @param nbThreads the number of threads (0 means
+     * Traversal::defaultNbThreads()).
+     */
+    BorderExtractor( const Object & object, unsigned int nbThreads = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~BorderExtractor();
+
+    /// @return the number of border points.
+    Size size() const;
+
+    /// @return an iterator on the first border point.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last border point.
+    ConstIterator end() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The numbering of the bounding box of the object, enlarged by
+    /// one point.
+    Linearizer myLinearizer;
+    /// The index distance to each lambda-neighbor.
+    std::vector<typename Linearizer::Offset> myOffsets;
+    /// The state of each point of the box (OUT, IN or OUTSIDE).
+    std::vector<unsigned char> myMask;
+    /// The border points.
+    std::vector<Point> myPoints;
+
+    /**
+     * The marks of the mask: the points of the domain that are not in
+     * the object, the points of the object, and the points that are
+     * not in the domain of the object.
+     */
+    enum Mark { OUT = 0, IN = 1, OUTSIDE = 2 };
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BorderExtractor ( const BorderExtractor & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BorderExtractor & operator= ( const BorderExtractor & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Predicate telling the border points of the mask, for
+     * Traversal::parallelSelect.
+     */
+    struct IsBorder
+    {
+      IsBorder( const BorderExtractor & extractor ) : myE( &extractor ) {}
+      bool operator()( const Point & p ) const;
+      const BorderExtractor* myE;
+    };
+
+    /**
+     * Rasterizes [object] and extracts its border.
+     * @param object the object given at construction.
+     * @param nbThreads the number of threads.
+     */
+    void compute( const Object & object, unsigned int nbThreads );
+
+  }; // end of class BorderExtractor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BorderExtractor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BorderExtractor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const BorderExtractor<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/BorderExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BorderExtractor_h
+
+#undef BorderExtractor_RECURSES
+#endif // else defined(BorderExtractor_RECURSES)
@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ComponentLabeling.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ComponentLabeling.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ComponentLabeling_RECURSES)
+#error Recursive header files inclusion detected in ComponentLabeling.h
+#else // defined(ComponentLabeling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ComponentLabeling_RECURSES
+
+#if !defined ComponentLabeling_h
+/** Prevents repeated inclusion of headers. */
+#define ComponentLabeling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ComponentLabeling
+  /**
+   * Description of template class 'ComponentLabeling' <p> \brief Aim:
+   * Computes the connected components of a digital object in one pass,
+   * as a label image over the bounding box of the object together
+   * with the points of each component.
+   *
+   * The points of the object are first written in the label image,
+   * then each unlabeled point starts a breadth-first traversal along
+   * the foreground adjacency of the object. Membership tests are
+   * array lookups in the label image, so the whole labeling is linear
+   * in the number of points (plus the size of the bounding box). The
+   * points of a component are stored contiguously, in the order of
+   * the traversal.
+   *
+   * Labels go from 1 to nbComponents(); 0 is the label of the points
+   * of the bounding box that are not in the object. Since the label
+   * image covers the bounding box, this class is meant for objects
+   * that fill a reasonable part of their bounding box.
+   *
+   * @code
+   * ComponentLabeling<Z3i::Object6_18> labeling( object );
+   * for ( unsigned int l = 1; l <= labeling.nbComponents(); ++l )
+   *   std::cout << std::distance( labeling.begin( l ), labeling.end( l ) );
+   * @endcode
+   *
+   * @tparam TObject the type of object, a specialization of Object.
+   * @see Object::writeComponents
+   */
+  template <typename TObject>
+  class ComponentLabeling
+  {
+  public:
+    typedef TObject Object;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename Object::Space Space;
+    typedef HyperRectDomain<Space> Domain;
+    typedef DGtal::uint32_t Label;
+    typedef ImageContainerBySTLVector<Domain,Label> LabelImage;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the components of [object].
+     * @param object any object.
+     */
+    ComponentLabeling( const Object & object );
+
+    /**
+     * Destructor.
+     */
+    ~ComponentLabeling();
+
+    /// @return the number of connected components of the object.
+    Size nbComponents() const;
+
+    /// @return the bounding box of the object, the domain of labelImage().
+    const Domain & domain() const;
+
+    /// @return the label image, with 0 outside the object.
+    const LabelImage & labelImage() const;
+
+    /**
+     * @param p any point.
+     * @return the label of the component of [p], or 0 if [p] is not in
+     * the object.
+     */
+    Label label( const Point & p ) const;
+
+    /**
+     * @param l a label in [1,nbComponents()].
+     * @return an iterator on the first point of the component [l].
+     */
+    ConstIterator begin( Label l ) const;
+
+    /**
+     * @param l a label in [1,nbComponents()].
+     * @return an iterator after the last point of the component [l].
+     */
+    ConstIterator end( Label l ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The bounding box of the object.
+    Domain myDomain;
+    /// The label of each point of the bounding box.
+    LabelImage myLabels;
+    /// The points of the object, grouped by component.
+    std::vector<Point> myPoints;
+    /// The component l is [myOffsets[l-1],myOffsets[l]) in myPoints.
+    std::vector<Size> myOffsets;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ComponentLabeling ( const ComponentLabeling & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ComponentLabeling & operator= ( const ComponentLabeling & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param object any object.
+     * @return the bounding box of [object], or a one-point box if it
+     * is empty.
+     */
+    static Domain boundingBox( const Object & object );
+
+    /**
+     * Labels the components of [object].
+     * @param object the object given at construction.
+     */
+    void compute( const Object & object );
+
+  }; // end of class ComponentLabeling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ComponentLabeling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ComponentLabeling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const ComponentLabeling<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ComponentLabeling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ComponentLabeling_h
+
+#undef ComponentLabeling_RECURSES
+#endif // else defined(ComponentLabeling_RECURSES)
@@ -0,0 +1,257 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponents.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ConnectedComponents.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponents_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponents.h
+#else // defined(ConnectedComponents_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponents_RECURSES
+
+#if !defined ConnectedComponents_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponents_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/topology/MetricAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponents
+  /**
+   * Description of template class 'ConnectedComponents' <p> \brief
+   * Aim: Labels the connected components of an image, two points
+   * being connected when they are adjacent and have the same value.
+   *
+   * The adjacency is the one of MetricAdjacency with the same
+   * [maxNorm1]: 1 gives the 4-adjacency in 2D and the 6-adjacency in
+   * 3D, 2 gives the 8- and 18-adjacencies, 3 gives the 26-adjacency.
+   *
+   * The labeling is a union-find on a flat array of parents, indexed
+   * like ImageContainerBySTLVector (first coordinate varying
+   * fastest). Each point is linked to its adjacent predecessors in
+   * this order, a root being always the smallest index of its tree.
+   * The domain is split into slabs along its last coordinate, which
+   * are labeled concurrently when OpenMP is available; the trees are
+   * then merged across the borders of the slabs. A last pass turns
+   * the array of parents into consecutive labels in place.
+   *
+   * @code
+   * ConnectedComponents<Image,1> cc( image );
+   * trace.info() << cc.nbComponents() << " 6-components" << std::endl;
+   * cc.writeLabels( labelImage );
+   * @endcode
+   *
+   * @tparam TImage any model of CImageContainer whose domain is a
+   * HyperRectDomain.
+   * @tparam maxNorm1 the maximal 1-norm of a displacement between two
+   * adjacent points, in [1,dimension].
+   * @tparam TLabel the integer type of labels, which must be able to
+   * number all the points of the domain. The default type numbers up
+   * to 2^32 points; use DGtal::uint64_t for larger domains.
+   */
+  template <typename TImage, Dimension maxNorm1,
+	    typename TLabel = DGtal::uint32_t>
+  class ConnectedComponents
+  {
+  public:
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Value Value;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef TLabel Label;
+    typedef HyperRectDomainTraversal<Domain> Traversal;
+    typedef HyperRectDomainLinearizer<Domain> Linearizer;
+    typedef MetricAdjacency<typename Domain::Space, maxNorm1> Adjacency;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Labels the components of [image].
+     *
+     * @param image any image.
+     * @param nbThreads the number of threads (0 means
+     * Traversal::defaultNbThreads()).
+     *
+     * @throw InputException if the type of labels cannot number all
+     * the points of the domain.
+     */
+    ConnectedComponents( const Image & image, unsigned int nbThreads = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponents();
+
+    /// @return the number of connected components.
+    Size nbComponents() const;
+
+    /// @return the domain of the labeled image.
+    const Domain & domain() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the label of the component of [p], in [0,nbComponents()).
+     */
+    Label label( const Point & p ) const;
+
+    /**
+     * @return the labels of the points of the domain, the first
+     * coordinate varying fastest.
+     */
+    const std::vector<Label> & labels() const;
+
+    /**
+     * Writes the label of each point of the domain in [labelImage].
+     * @param labelImage any image defined on (at least) the domain.
+     */
+    template <typename TLabelImage>
+    void writeLabels( TLabelImage & labelImage ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The numbering of the points of the domain of the image.
+    Linearizer myLinearizer;
+    /// The displacements to the adjacent predecessors of a point.
+    std::vector<Point> myOffsets;
+    /// The index distance to each adjacent predecessor.
+    std::vector<Size> myDistances;
+    /// The parents during the union-find, then the labels.
+    std::vector<Label> myLabels;
+    /// The number of components.
+    Size myNbComponents;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConnectedComponents ( const ConnectedComponents & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConnectedComponents & operator= ( const ConnectedComponents & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param i any index.
+     * @return the root of the tree of [i], halving the path to it.
+     */
+    Label find( Label i );
+
+    /**
+     * Merges the trees of [i] and [j], the root of the smallest index
+     * becoming the root of the other one.
+     */
+    void merge( Label i, Label j );
+
+    /**
+     * Links each point of [block] to its adjacent predecessors with
+     * the same value that lie within [lower,upper].
+     *
+     * @param image the labeled image.
+     * @param block a box of the domain spanning all the coordinates
+     * but the last one.
+     * @param lower the lowest point of the box of allowed predecessors.
+     * @param upper the highest point of the box of allowed predecessors.
+     * @param crossing when 'false', the points of [block] are first made
+     * roots; when 'true', only the predecessors in the previous slice
+     * along the last coordinate are considered.
+     */
+    void link( const Image & image, const Domain & block,
+	       const Point & lower, const Point & upper, bool crossing );
+
+    /**
+     * Replaces each parent with the label of its tree.
+     */
+    void relabel();
+
+  }; // end of class ConnectedComponents
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponents'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponents' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, Dimension maxNorm1, typename TLabel>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const ConnectedComponents<TImage,maxNorm1,TLabel> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponents.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponents_h
+
+#undef ConnectedComponents_RECURSES
+#endif // else defined(ConnectedComponents_RECURSES)
@@ -211,6 +211,19 @@ namespace DGtal
     void writeProperNeighborhood( const Point & p, 
 				  OutputIterator & out_it ) const;
 
+    /**
+     * Calls f( q ) for each point q of the neighborhood of [p] (except
+     * p itself) that lies in this domain. The adjacency must provide
+     * forEachNeighbor, like MetricAdjacency.
+     *
+     * @tparam Functor any functor taking a 'const Point &'.
+     *
+     * @param p any point of this space.
+     * @param f the functor.
+     */
+    template <typename Functor>
+    void forEachNeighbor( const Point & p, Functor & f ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -262,6 +275,17 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// Calls a functor on the visited points that lie in the domain.
+    template <typename Functor>
+    struct DomainFilter
+    {
+      const Predicate & myPred;
+      Functor & myFunctor;
+      DomainFilter( const Predicate & pred, Functor & f )
+	: myPred( pred ), myFunctor( f ) {}
+      void operator()( const Point & q ) { if ( myPred( q ) ) myFunctor( q ); }
+    };
+
   }; // end of class DomainAdjacency
 
 
@@ -0,0 +1,295 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FrontierExpander.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module FrontierExpander.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FrontierExpander_RECURSES)
+#error Recursive header files inclusion detected in FrontierExpander.h
+#else // defined(FrontierExpander_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FrontierExpander_RECURSES
+
+#if !defined FrontierExpander_h
+/** Prevents repeated inclusion of headers. */
+#define FrontierExpander_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/topology/MetricAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FrontierExpander
+  /**
+   * Description of template class 'FrontierExpander' <p> \brief Aim:
+   * Visits an object by adjacencies, layer by layer, like Expander,
+   * but without storing the core.
+   *
+   * The points of the object that are not yet visited are marked in
+   * a bitmap over the bounding box of the object (enlarged by one
+   * point), and the neighbors of a point are read at fixed linear
+   * offsets in this bitmap. Only the current layer is stored, as a
+   * flat vector of points, and the next layer is built from it. The
+   * memory is thus one bit per point of the bounding box plus the
+   * size of two layers, whatever the number of visited points, and
+   * the expansion runs at the speed of a scan of the bitmap.
+   *
+   * The layers are the ones of Expander: after construction, the
+   * current layer is the layer at distance 1 of the initial core,
+   * unless the expander is already finished. Once finished, the
+   * current layer is empty.
+   *
+   * @code
+   * FrontierExpander<Z3i::Object6_18> expander( object, p );
+   * while ( ! expander.finished() )
+   *   {
+   *     for ( FrontierExpander<Z3i::Object6_18>::ConstIterator
+   *             it = expander.begin(); it != expander.end(); ++it )
+   *       distanceMap.setValue( *it, expander.distance() );
+   *     expander.nextLayer();
+   *   }
+   * @endcode
+   *
+   * Or equivalently, with a functor f called as f( point, distance ):
+   * @code
+   * expander.expand( f );
+   * @endcode
+   *
+   * @tparam TObject the type of the digital object, whose foreground
+   * adjacency is a MetricAdjacency.
+   *
+   * @see Expander
+   */
+  template <typename TObject>
+  class FrontierExpander
+  {
+    BOOST_STATIC_ASSERT
+    (( IsMetricAdjacency<typename TObject::ForegroundAdjacency>::value ));
+
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef TObject Object;
+    typedef typename Object::Size Size;
+    typedef typename Object::Point Point;
+    typedef typename Object::Space Space;
+    typedef typename Object::ForegroundAdjacency ForegroundAdjacency;
+    typedef HyperRectDomain<Space> Domain;
+    typedef HyperRectDomainLinearizer<Domain> Linearizer;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~FrontierExpander();
+
+    /**
+     * Constructor from a point. This point provides the initial core
+     * of the expander.
+     *
+     * @param object the digital object in which the expander expands.
+     * @param p any point in the given object.
+     */
+    FrontierExpander( const Object & object, const Point & p );
+
+    /**
+     * Constructor from iterators. The points visited between the
+     * iterators provide the initial core of the expander.
+     *
+     * @tparam PointInputIterator the type of an InputIterator pointing
+     * on a Point.
+     *
+     * @param object the digital object in which the expander expands.
+     * @param b the begin point in a set.
+     * @param e the end point in a set.
+     */
+    template <typename PointInputIterator>
+    FrontierExpander( const Object & object,
+		      PointInputIterator b, PointInputIterator e );
+
+    // ----------------------- Expansion services ------------------------------
+  public:
+
+    /**
+     * @return 'true' if all possible elements have been visited.
+     */
+    bool finished() const;
+
+    /**
+     * @return the current distance to the initial core, or
+     * equivalently the index of the current layer.
+     */
+    Size distance() const;
+
+    /**
+     * Extract next layer. You might used begin() and end() to access
+     * all the elements of the new layer.
+     *
+     * @return 'true' if there was another layer, or 'false' if it was the
+     * last (ie. reverse of finished() ).
+     */
+    bool nextLayer();
+
+    /**
+     * Calls [f]( p, distance() ) for each point p of the current layer,
+     * then moves to the next layer, until the expander is finished.
+     *
+     * @tparam TFunctor the type of a functor on a point and a distance.
+     * @param f the functor.
+     */
+    template <typename TFunctor>
+    void expand( TFunctor & f );
+
+    /**
+     * @return a const reference on the points of the current layer.
+     */
+    const std::vector<Point> & layer() const;
+
+    /**
+     * @return the iterator on the first element of the layer.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return the iterator after the last element of the layer.
+     */
+    ConstIterator end() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The numbering of the bounding box of the object, enlarged by
+    /// one point.
+    Linearizer myLinearizer;
+    /// The index distance to each proper neighbor.
+    std::vector<typename Linearizer::Offset> myOffsets;
+    /// The points of the object that are not visited yet.
+    std::vector<bool> myUnvisited;
+    /// The points of the current layer.
+    std::vector<Point> myLayer;
+    /// The indices of the points of the current layer.
+    std::vector<Size> myLayerIndices;
+    /// The points of the next layer, while it is computed.
+    std::vector<Point> myNextLayer;
+    /// The indices of the points of the next layer.
+    std::vector<Size> myNextLayerIndices;
+    /// Current distance to origin.
+    Size myDistance;
+    /// Boolean stating whether the expansion is over or not.
+    bool myFinished;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FrontierExpander ( const FrontierExpander & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FrontierExpander & operator= ( const FrontierExpander & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Builds the bitmap of [object] and the offsets of the adjacency.
+     * @param object the object given at construction.
+     */
+    void init( const Object & object );
+
+    /**
+     * Marks [p] as visited and puts it in the current layer.
+     * @param p any point of the object.
+     */
+    void addToCore( const Point & p );
+
+    /**
+     * Replaces the current layer with the unvisited neighbors of its
+     * points, or sets myFinished when there is none.
+     */
+    void computeNextLayer();
+
+  }; // end of class FrontierExpander
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FrontierExpander'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FrontierExpander' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const FrontierExpander<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/FrontierExpander.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FrontierExpander_h
+
+#undef FrontierExpander_RECURSES
+#endif // else defined(FrontierExpander_RECURSES)
@@ -0,0 +1,257 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file GeodesicDistance.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module GeodesicDistance.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GeodesicDistance_RECURSES)
+#error Recursive header files inclusion detected in GeodesicDistance.h
+#else // defined(GeodesicDistance_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GeodesicDistance_RECURSES
+
+#if !defined GeodesicDistance_h
+/** Prevents repeated inclusion of headers. */
+#define GeodesicDistance_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/FrontierExpander.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class GeodesicDistance
+  /**
+   * Description of template class 'GeodesicDistance' <p> \brief Aim:
+   * Computes the geodesic distance within an object to a set of seed
+   * points, i.e. the length of a shortest path of adjacent points of
+   * the object from any seed.
+   *
+   * Two kinds of path lengths are available:
+   *
+   * - the number of steps, computed by a breadth-first traversal from
+   *   all the seeds at once with a FrontierExpander;
+   *
+   * - a weighted length, each step costing a positive integer weight
+   *   that depends on the 1-norm of the step (e.g. the chamfer
+   *   weights 3, 4, 5 for the steps of norm 1, 2, 3 in 3D), computed
+   *   by a Dijkstra traversal with a bucket queue.
+   *
+   * The steps are the neighbors of the origin for the foreground
+   * adjacency of the object, which should be a MetricAdjacency. The
+   * distances are stored in an array over the bounding box of the
+   * object; the points that cannot be reached from the seeds are at
+   * distance infinity().
+   *
+   * @code
+   * GeodesicDistance<Z3i::Object26_6> geodesic( object );
+   * geodesic.compute( seeds.begin(), seeds.end() );
+   * geodesic.writeDistances( distanceImage );
+   * @endcode
+   *
+   * @tparam TObject the type of the digital object, whose foreground
+   * adjacency is a MetricAdjacency.
+   *
+   * @see FrontierExpander
+   */
+  template <typename TObject>
+  class GeodesicDistance
+  {
+    BOOST_STATIC_ASSERT
+    (( IsMetricAdjacency<typename TObject::ForegroundAdjacency>::value ));
+
+  public:
+    typedef TObject Object;
+    typedef typename Object::Size Size;
+    typedef typename Object::Point Point;
+    typedef typename Object::Space Space;
+    typedef typename Object::ForegroundAdjacency ForegroundAdjacency;
+    typedef HyperRectDomain<Space> Domain;
+    typedef HyperRectDomainLinearizer<Domain> Linearizer;
+    typedef DGtal::uint32_t Distance;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. No distance is computed yet.
+     * @param object the digital object, which should not be empty.
+     */
+    GeodesicDistance( const Object & object );
+
+    /**
+     * Destructor.
+     */
+    ~GeodesicDistance();
+
+    /// @return the distance of the points that cannot be reached.
+    static Distance infinity();
+
+    /**
+     * Computes the number of steps from the seeds to each point.
+     *
+     * @tparam PointInputIterator the type of an InputIterator pointing
+     * on a Point.
+     * @param b the begin of the seeds, which are points of the object.
+     * @param e the end of the seeds, which may be repeated.
+     */
+    template <typename PointInputIterator>
+    void compute( PointInputIterator b, PointInputIterator e );
+
+    /**
+     * Computes the weighted length of a shortest path from the seeds
+     * to each point.
+     *
+     * @tparam PointInputIterator the type of an InputIterator pointing
+     * on a Point.
+     * @param b the begin of the seeds, which are points of the object.
+     * @param e the end of the seeds.
+     * @param weights the weight of a step of 1-norm k is weights[k],
+     * a positive integer, for k from 1 to the largest 1-norm of a step.
+     */
+    template <typename PointInputIterator>
+    void compute( PointInputIterator b, PointInputIterator e,
+		  const std::vector<Distance> & weights );
+
+    /**
+     * @param p any point.
+     * @return the distance of [p] to the seeds, or infinity() if [p]
+     * is not reached.
+     */
+    Distance distance( const Point & p ) const;
+
+    /**
+     * Writes the distance of each point of the object in [image].
+     *
+     * @tparam TImage any model of CImageContainer whose values can be
+     * assigned distances.
+     * @param image any image defined on (at least) the object.
+     */
+    template <typename TImage>
+    void writeDistances( TImage & image ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The object.
+    const Object & myObject;
+    /// The numbering of the bounding box of the object, enlarged by
+    /// one point.
+    Linearizer myLinearizer;
+    /// The index distance to each neighbor.
+    std::vector<typename Linearizer::Offset> myOffsets;
+    /// The 1-norm of the step to each neighbor.
+    std::vector<Dimension> myNorms;
+    /// Tells the points of the object.
+    std::vector<bool> myMask;
+    /// The distance of each point of the box.
+    std::vector<Distance> myDistances;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    GeodesicDistance ( const GeodesicDistance & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    GeodesicDistance & operator= ( const GeodesicDistance & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Writes the distances of the layers of a FrontierExpander.
+     */
+    struct LayerWriter
+    {
+      LayerWriter( GeodesicDistance & g ) : myG( &g ) {}
+      void operator()( const Point & p, Size d )
+      {
+	myG->myDistances[ myG->myLinearizer.index( p ) ] = (Distance) d;
+      }
+      GeodesicDistance* myG;
+    };
+
+  }; // end of class GeodesicDistance
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'GeodesicDistance'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'GeodesicDistance' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const GeodesicDistance<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/GeodesicDistance.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GeodesicDistance_h
+
+#undef GeodesicDistance_RECURSES
+#endif // else defined(GeodesicDistance_RECURSES)
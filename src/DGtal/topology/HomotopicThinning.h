@@ -0,0 +1,279 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HomotopicThinning.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module HomotopicThinning.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HomotopicThinning_RECURSES)
+#error Recursive header files inclusion detected in HomotopicThinning.h
+#else // defined(HomotopicThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HomotopicThinning_RECURSES
+
+#if !defined HomotopicThinning_h
+/** Prevents repeated inclusion of headers. */
+#define HomotopicThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/SimplePointTable.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HomotopicThinning
+  /**
+   * Description of template class 'HomotopicThinning' <p> \brief Aim:
+   * Removes the simple points of an object as long as possible, in the
+   * order given by a priority image and keeping some anchor points,
+   * so that the object keeps its topology.
+   *
+   * The object is first rasterized in a byte mask over its bounding
+   * box, so that the configuration of a neighborhood is read with
+   * linear offsets and answered by SimplePointTable. The border points
+   * (the points with a neighbor outside the object) are stored in a
+   * bucket queue sorted by priority. The bucket of lowest priority is
+   * processed by sub-fields: the points whose coordinates have the
+   * same parities are never adjacent, so the simplicity of the points
+   * of one sub-field is tested concurrently (with OpenMP) and all the
+   * simple ones are removed together, exactly as if they were removed
+   * one after the other. The neighbors of the removed points are then
+   * queued with their own priority. The result is independent of the
+   * number of threads.
+   *
+   * Without priority image, all the points have the same priority and
+   * the object is peeled layer after layer. With a distance map as
+   * priority image, the points closest to the background are removed
+   * first, which centers the skeleton.
+   *
+   * @code
+   * HomotopicThinning<Z3i::Object26_6> thinning( object );
+   * thinning.thin( distanceMap, isEndPoint );
+   * @endcode
+   *
+   * @tparam TObject the type of object, a specialization of Object whose
+   * digital topology is handled by SimplePointTable (two metric
+   * adjacencies in dimension 2 or 3).
+   *
+   * @see Object::isSimple
+   */
+  template <typename TObject>
+  class HomotopicThinning
+  {
+    BOOST_STATIC_ASSERT
+    (( SimplePointTable<typename TObject::DigitalTopology>::available ));
+
+  public:
+    typedef TObject Object;
+    typedef typename Object::DigitalTopology DigitalTopology;
+    typedef typename Object::DigitalSet DigitalSet;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename Object::Space Space;
+    typedef HyperRectDomain<Space> Domain;
+    typedef HyperRectDomainTraversal<Domain> Traversal;
+    typedef HyperRectDomainLinearizer<Domain> Linearizer;
+    typedef SimplePointTable<DigitalTopology> Table;
+    typedef typename Table::Configuration Configuration;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param object the object to thin, which is modified by thin().
+     * @param nbThreads the number of threads (0 means
+     * Traversal::defaultNbThreads()).
+     */
+    HomotopicThinning( Object & object, unsigned int nbThreads = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~HomotopicThinning();
+
+    /**
+     * Thins the object layer after layer.
+     * @return the number of removed points.
+     */
+    Size thin();
+
+    /**
+     * Thins the object, the points of lowest priority first.
+     *
+     * @tparam TPriorityImage any image whose values are ordered.
+     * @param priority an image defined on the points of the object.
+     * @return the number of removed points.
+     */
+    template <typename TPriorityImage>
+    Size thin( const TPriorityImage & priority );
+
+    /**
+     * Thins the object, the points of lowest priority first, without
+     * removing the anchor points.
+     *
+     * @tparam TPriorityImage any image whose values are ordered.
+     * @tparam TAnchorPredicate any predicate on points, which may be
+     * called concurrently.
+     * @param priority an image defined on the points of the object.
+     * @param anchor the predicate telling the points to keep.
+     * @return the number of removed points.
+     */
+    template <typename TPriorityImage, typename TAnchorPredicate>
+    Size thin( const TPriorityImage & priority,
+	       const TAnchorPredicate & anchor );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The thinned object.
+    Object & myObject;
+    /// The number of threads.
+    unsigned int myNbThreads;
+    /// The numbering of the bounding box of the object, enlarged by
+    /// one point.
+    Linearizer myLinearizer;
+    /// The displacement to each point of the neighborhood.
+    std::vector<Point> myDisplacements;
+    /// The index distance to each point of the neighborhood.
+    std::vector<typename Linearizer::Offset> myOffsets;
+    /// The state of each point of the box (IN and QUEUED flags).
+    std::vector<unsigned char> myMask;
+
+    /// Flag of the points of the object.
+    static const unsigned char IN = 1;
+    /// Flag of the points that are in the queue.
+    static const unsigned char QUEUED = 2;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    HomotopicThinning ( const HomotopicThinning & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    HomotopicThinning & operator= ( const HomotopicThinning & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The priority of thin() without priority image.
+    struct ConstantPriority
+    {
+      typedef int Value;
+      Value operator()( const Point & ) const { return 0; }
+    };
+
+    /// The anchors of thin() without anchor predicate.
+    struct NoAnchor
+    {
+      bool operator()( const Point & ) const { return false; }
+    };
+
+    /**
+     * Rasterizes the object in myMask.
+     */
+    void rasterize();
+
+    /**
+     * Replaces the points of the object with the points of myMask.
+     */
+    void writeBack();
+
+    /**
+     * @param i the index of any point of the object.
+     * @return the configuration of its neighborhood.
+     */
+    Configuration configuration( Size i ) const;
+
+    /**
+     * @param p any point.
+     * @return the sub-field of [p], given by the parities of its
+     * coordinates.
+     */
+    static unsigned int subfield( const Point & p );
+
+  }; // end of class HomotopicThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HomotopicThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HomotopicThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const HomotopicThinning<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/HomotopicThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HomotopicThinning_h
+
+#undef HomotopicThinning_RECURSES
+#endif // else defined(HomotopicThinning_RECURSES)
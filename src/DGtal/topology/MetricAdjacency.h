@@ -50,6 +50,121 @@
 namespace DGtal
 {
 
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MetricStencil
+  /**
+   * Description of template class 'MetricStencil' <p> \brief Aim:
+   * Enumerates the points of a metric neighborhood with loops unrolled
+   * at compile time.
+   *
+   * The point q is moved by -1, 0 and +1 along its coordinate n-1,
+   * then the points of the stencil of the n-1 first coordinates are
+   * visited, so that the points come in the order of a HyperRectDomain
+   * (first coordinate varying fastest). Each non-null displacement
+   * consumes one unit of the 1-norm budget, and the last coordinates
+   * are not moved any more when the budget is exhausted.
+   *
+   * @tparam n the number of coordinates still to move (0 to n-1).
+   * @tparam maxNorm1 the 1-norm budget of the remaining displacement.
+   * @tparam skipCenter when 'true', the coordinates already visited
+   * are the ones of the center and the center itself is skipped.
+   */
+  template <Dimension n, Dimension maxNorm1, bool skipCenter>
+  struct MetricStencil
+  {
+    typedef MetricStencil<n - 1, maxNorm1 - 1, false> MovedStencil;
+    typedef MetricStencil<n - 1, maxNorm1, skipCenter> FixedStencil;
+
+    /// The number of visited points.
+    static const unsigned int size =
+      2 * MovedStencil::size + FixedStencil::size;
+
+    /**
+     * Calls f( q ) for each point q of the stencil around [q].
+     *
+     * @tparam TPoint any point type.
+     * @tparam TFunctor any functor taking a point.
+     * @param q the center, which is restored when the function returns.
+     * @param f the functor.
+     */
+    template <typename TPoint, typename TFunctor>
+    static void visit( TPoint & q, TFunctor & f )
+    {
+      --q[ n - 1 ];
+      MovedStencil::visit( q, f );
+      ++q[ n - 1 ];
+      FixedStencil::visit( q, f );
+      ++q[ n - 1 ];
+      MovedStencil::visit( q, f );
+      --q[ n - 1 ];
+    }
+
+    /**
+     * The table is filled at the first call.
+     *
+     * @tparam TPoint any point type.
+     * @return the [size] visited points around the origin, in the
+     * order of visit().
+     */
+    template <typename TPoint>
+    static const TPoint * offsets()
+    {
+      static const Table<TPoint> table;
+      return table.myPoints;
+    }
+
+  private:
+    /// The points visited around the origin.
+    template <typename TPoint>
+    struct Table
+    {
+      TPoint myPoints[ size ];
+      unsigned int myNb;
+      Table() : myNb( 0 )
+      {
+	TPoint origin = TPoint::diagonal( 0 );
+	visit( origin, *this );
+      }
+      void operator()( const TPoint & q ) { myPoints[ myNb++ ] = q; }
+    };
+  };
+
+  /// Stencil without coordinate left to move: the point itself.
+  template <Dimension maxNorm1, bool skipCenter>
+  struct MetricStencil<0, maxNorm1, skipCenter>
+  {
+    static const unsigned int size = skipCenter ? 0 : 1;
+    template <typename TPoint, typename TFunctor>
+    static void visit( TPoint & q, TFunctor & f )
+    {
+      if ( ! skipCenter ) f( const_cast<const TPoint &>( q ) );
+    }
+  };
+
+  /// Stencil with an exhausted budget: the point itself.
+  template <Dimension n, bool skipCenter>
+  struct MetricStencil<n, 0, skipCenter>
+  {
+    static const unsigned int size = skipCenter ? 0 : 1;
+    template <typename TPoint, typename TFunctor>
+    static void visit( TPoint & q, TFunctor & f )
+    {
+      if ( ! skipCenter ) f( const_cast<const TPoint &>( q ) );
+    }
+  };
+
+  /// Disambiguates the two previous specializations.
+  template <bool skipCenter>
+  struct MetricStencil<0, 0, skipCenter>
+  {
+    static const unsigned int size = skipCenter ? 0 : 1;
+    template <typename TPoint, typename TFunctor>
+    static void visit( TPoint & q, TFunctor & f )
+    {
+      if ( ! skipCenter ) f( const_cast<const TPoint &>( q ) );
+    }
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class MetricAdjacency
   /**
@@ -70,6 +185,11 @@ namespace DGtal
    * less or equal than 1 and if their norm-1 is less or equal than
    * maxNorm1.
    *
+   * The neighborhoods are enumerated by a MetricStencil, whose loops
+   * are unrolled at compile time. forEachNeighbor() calls a functor on
+   * each neighbor without filling any container, and offsets() gives
+   * the displacements to the neighbors.
+   *
    * @see testAdjacency.cpp
    */
   template <typename TSpace, Dimension maxNorm1, 
@@ -87,6 +207,14 @@ namespace DGtal
     // Others
     typedef typename Space::Vector Vector;
 
+    /// The stencil of the neighborhood, the point itself excluded.
+    typedef MetricStencil<dimension, maxNorm1, true> ProperStencil;
+    /// The stencil of the neighborhood, the point itself included.
+    typedef MetricStencil<dimension, maxNorm1, false> Stencil;
+
+    /// The number of neighbors of a point, the point itself excluded.
+    static const unsigned int nbNeighbors = ProperStencil::size;
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -194,6 +322,26 @@ namespace DGtal
     static
     void writeProperNeighborhood( const Point & p, 
 				  OutputIterator & out_it );
+
+    /**
+     * Calls f( q ) for each point q of the neighborhood of [p] (except
+     * p itself), in the order of writeProperNeighborhood.
+     *
+     * @tparam Functor any functor taking a 'const Point &'.
+     *
+     * @param p any point of this space.
+     * @param f the functor.
+     */
+    template <typename Functor>
+    static
+    void forEachNeighbor( const Point & p, Functor & f );
+
+    /**
+     * @return the displacements from a point to its [nbNeighbors]
+     * neighbors, in the order of forEachNeighbor.
+     */
+    static
+    const Vector * offsets();
     
     // ----------------------- Interface --------------------------------------
   public:
@@ -241,6 +389,26 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// Writes the visited points in an output iterator.
+    template <typename OutputIterator>
+    struct Writer
+    {
+      OutputIterator & myOut;
+      Writer( OutputIterator & out ) : myOut( out ) {}
+      void operator()( const Point & q ) { *myOut++ = q; }
+    };
+
+    /// Writes the visited points satisfying a predicate.
+    template <typename OutputIterator, typename PointPredicate>
+    struct FilteredWriter
+    {
+      OutputIterator & myOut;
+      const PointPredicate & myPred;
+      FilteredWriter( OutputIterator & out, const PointPredicate & pred )
+	: myOut( out ), myPred( pred ) {}
+      void operator()( const Point & q ) { if ( myPred( q ) ) *myOut++ = q; }
+    };
+
   }; // end of class MetricAdjacency
 
   /**
@@ -273,6 +441,25 @@ namespace DGtal
    */
   typedef MetricAdjacency< SpaceND<3>, 3> Z3Adj26;
 
+  /**
+   * Tells whether an adjacency is a MetricAdjacency, whose
+   * neighborhoods are the translations of the neighborhood of the
+   * origin.
+   *
+   * @tparam TAdjacency any model of CAdjacency.
+   */
+  template <typename TAdjacency>
+  struct IsMetricAdjacency
+  {
+    static const bool value = false;
+  };
+
+  template <typename TSpace, Dimension maxNorm1, Dimension dimension>
+  struct IsMetricAdjacency< MetricAdjacency<TSpace, maxNorm1, dimension> >
+  {
+    static const bool value = true;
+  };
+
   /**
    * Overloads 'operator<<' for displaying objects of class 'MetricAdjacency'.
    * @param out the output stream where the object is written.
@@ -42,10 +42,12 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <boost/type_traits/integral_constant.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -81,6 +83,12 @@ namespace DGtal
    * "DrawAdjacencies". In this case the set of points and the
    * adjacency relations are displayed.
    *
+   * The size of the neighborhoods may be cached in an image around
+   * the object (see enableNeighborhoodSizeCache), which insert() and
+   * erase() update incrementally. Editing the object through these
+   * two methods also keeps its connectedness whenever it is known to
+   * be unchanged.
+   *
    * @tparam TDigitalTopology any realization of DigitalTopology.
    * @tparam TDigitalSet any model of CDigitalSet.
    */
@@ -107,6 +115,9 @@ namespace DGtal
       typedef Object<ReverseTopology, DigitalSet> ComplementObject;
       typedef Object<DigitalTopology, SmallSet> SmallObject;
       typedef Object<ReverseTopology, SmallSet> SmallComplementObject;
+      /// The image of the proper neighborhood sizes.
+      typedef ImageContainerBySTLVector<Domain, unsigned int>
+      NeighborhoodSizeImage;
 
       /**
        * Kind of connectedness of this object.
@@ -244,6 +255,11 @@ namespace DGtal
       /**
        * A reference on the point set defining the points of the
        * digital object (may duplicate the set).
+       *
+       * NB: the connectedness becomes UNKNOWN and the cached
+       * neighborhood sizes are released, until
+       * enableNeighborhoodSizeCache is called again. Prefer insert()
+       * and erase() to edit the object.
        */
       DigitalSet & pointSet();
 
@@ -318,6 +334,49 @@ namespace DGtal
       Size properNeighborhoodSize( const Point & p ) const;
 
 
+      // ----------------------- Editing services ------------------------------
+    public:
+
+      /**
+       * Adds a point to this object, updating the cached neighborhood
+       * sizes. The object stays connected if it was connected and [p]
+       * is adjacent to one of its points.
+       *
+       * @param p any point of the domain.
+       * @return 'true' iff [p] was not in the object.
+       */
+      bool insert( const Point & p );
+
+      /**
+       * Removes a point from this object, updating the cached
+       * neighborhood sizes. The object stays connected if it was
+       * connected and [p] is adjacent to at most one of its points.
+       *
+       * @param p any point of the domain.
+       * @return 'true' iff [p] was in the object.
+       */
+      bool erase( const Point & p );
+
+      /**
+       * Computes the size of the proper neighborhood of each point of
+       * the bounding box of the object, enlarged by one point, in an
+       * image, so that neighborhoodSize and properNeighborhoodSize
+       * become lookups. The image is shared by the copies of this
+       * object until one of them is modified. It grows with the
+       * object when insert() adds points out of it.
+       */
+      void enableNeighborhoodSizeCache();
+
+      /**
+       * Releases the cached neighborhood sizes.
+       */
+      void disableNeighborhoodSizeCache();
+
+      /**
+       * @return 'true' iff the neighborhood sizes are cached.
+       */
+      bool hasNeighborhoodSizeCache() const;
+
       // ----------------------- border services -------------------------------
     public:
 
@@ -426,6 +485,10 @@ namespace DGtal
        * careful, such a definition is valid only for Jordan couples in
        * dimension 2 and 3.
        *
+       * The usual topologies made of two metric adjacencies in
+       * dimension 2 and 3 are answered by SimplePointTable from the
+       * configuration of the 3^n neighborhood of [v].
+       *
        * @return 'true' if this point is simple.
        */
       bool isSimple( const Point & v ) const;
@@ -465,6 +528,13 @@ namespace DGtal
        */
       mutable Connectedness myConnectedness;
 
+      /**
+       * The size of the proper neighborhood of each point of the
+       * bounding box of the object enlarged by one point, or 0 if the
+       * sizes are not cached.
+       */
+      CowPtr<NeighborhoodSizeImage> myNeighborhoodSizes;
+
       // ------------------------- Hidden services ------------------------------
     protected:
 
@@ -482,9 +552,84 @@ namespace DGtal
         }
       };
 
-    
+      // ------------------------- Internals ------------------------------------
+    private:
 
-    
+      /**
+       * @param p any point.
+       * @return the cached size of the proper neighborhood of [p].
+       */
+      Size cachedNeighborhoodSize( const Point & p ) const;
+
+      /**
+       * Computes the cached neighborhood sizes from the point set, in
+       * an image over the box [lower,upper], which should contain the
+       * neighbors in the domain of all the points of the object.
+       *
+       * @param lower the lowest point of the image.
+       * @param upper the highest point of the image.
+       */
+      void computeNeighborhoodSizes( const Point & lower, const Point & upper );
+
+      /**
+       * Updates the cached neighborhood sizes around [p]. When [p]
+       * was inserted out of the image of the sizes, the image is
+       * enlarged and computed again.
+       *
+       * @param p a point inserted in or erased from the object.
+       * @param inserted 'true' iff [p] was inserted.
+       */
+      void updateNeighborhoodSizes( const Point & p, bool inserted );
+
+      /**
+       * The largest ratio between the volume of the bounding box and
+       * the size of an object for which the rasterized algorithms
+       * (BorderExtractor, ComponentLabeling) are used.
+       */
+      static const unsigned int maxBoundingBoxRatio = 64;
+
+      /**
+       * The rasterized algorithms scan the bounding box of the object,
+       * so they are used unless the object is very sparse within it.
+       *
+       * @return 'true' iff the object is not empty and its bounding box
+       * is at most maxBoundingBoxRatio times larger than the object.
+       */
+      bool isRasterizable() const;
+
+      /**
+       * Simplicity test through SimplePointTable, when the digital
+       * topology is handled by the table.
+       *
+       * @param v any point.
+       * @return 'true' if this point is simple.
+       */
+      bool isSimple( const Point & v, boost::true_type ) const;
+
+      /**
+       * Simplicity test through the geodesic neighborhoods, for any
+       * digital topology.
+       *
+       * @param v any point.
+       * @return 'true' if this point is simple.
+       */
+      bool isSimple( const Point & v, boost::false_type ) const;
+
+      /**
+       * Border through BorderExtractor, when the background adjacency
+       * is a MetricAdjacency.
+       *
+       * @return the border of this object.
+       */
+      Object border( boost::true_type ) const;
+
+      /**
+       * Border through the neighborhoods of the points, for any
+       * background adjacency.
+       *
+       * @return the border of this object.
+       */
+      Object border( boost::false_type ) const;
 
       // --------------- CDrawableWithDGtalBoard realization ------------------
     public:
@@ -0,0 +1,424 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedKhalimskyCell.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PackedKhalimskyCell.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedKhalimskyCell_RECURSES)
+#error Recursive header files inclusion detected in PackedKhalimskyCell.h
+#else // defined(PackedKhalimskyCell_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedKhalimskyCell_RECURSES
+
+#if !defined PackedKhalimskyCell_h
+/** Prevents repeated inclusion of headers. */
+#define PackedKhalimskyCell_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+     Represents an (unsigned) cell in a cellular grid space by a single
+     64-bit key.
+
+     The Khalimsky coordinate k, shifted by 2^(w-1) to be non-negative,
+     occupies the bits [k*w,(k+1)*w) of the key, where w =
+     bitsPerCoordinate = 63/dim. The lowest bit of each field is then
+     the topology of the cell along k (1 iff open), so that the
+     dimension of the cell is the number of bits of the key in
+     topologyMask(), and the adjacent and incident cells are obtained
+     by adding or subtracting 2 or 1 to the field. The top bit is left
+     for the sign of PackedSignedKhalimskyCell.
+
+     A packed cell weighs 8 bytes whatever the dimension, and its key
+     gives a total order (the last coordinate being the most
+     significant) and a hash value (for boost::hash). The Khalimsky
+     coordinates must lie in [minKCoord(),maxKCoord()], i.e. in
+     [-2^20,2^20) in 3D.
+
+     @code
+     typedef PackedKhalimskyCell< 3 > PackedCell;
+     PackedCell c( K.uSpel( p ) );
+     PackedCell f = c.uIncident( 0, true ); // a surfel
+     ASSERT( f.uDim() == 2 );
+     @endcode
+
+     @tparam dim the dimension of the space.
+     @tparam TInteger the type of the coordinates of the cells.
+   */
+  template < Dimension dim,
+	     typename TInteger = DGtal::int32_t >
+  struct PackedKhalimskyCell
+  {
+    BOOST_STATIC_ASSERT(( ( dim >= 1 ) && ( dim <= 31 ) ));
+
+  public:
+    typedef TInteger Integer;
+    typedef DGtal::uint64_t Key;
+    typedef PointVector< dim, Integer > Point;
+    typedef KhalimskyCell< dim, Integer > Cell;
+
+    /// The number of bits of each Khalimsky coordinate.
+    static const unsigned int bitsPerCoordinate = 63 / dim;
+
+    /// The key of the cell.
+    Key myKey;
+
+    /**
+     * Constructor. The cell of null Khalimsky coordinates.
+     */
+    PackedKhalimskyCell();
+
+    /**
+     * Constructor from a cell.
+     *
+     * @param cell any cell whose Khalimsky coordinates lie in
+     * [minKCoord(),maxKCoord()].
+     */
+    explicit PackedKhalimskyCell( const Cell & cell );
+
+    /**
+     * Constructor from Khalimsky coordinates.
+     *
+     * @param kp any point of Khalimsky coordinates lying in
+     * [minKCoord(),maxKCoord()].
+     */
+    explicit PackedKhalimskyCell( const Point & kp );
+
+    /**
+     * @param key any key of an unsigned cell.
+     * @return the cell of key [key].
+     */
+    static PackedKhalimskyCell fromKey( Key key );
+
+    /**
+     * @return the smallest Khalimsky coordinate of a packed cell.
+     */
+    static Integer minKCoord();
+
+    /**
+     * @return the greatest Khalimsky coordinate of a packed cell.
+     */
+    static Integer maxKCoord();
+
+    /**
+     * @return the bits giving the topology of the cell.
+     */
+    static Key topologyMask();
+
+    /**
+     * @return the corresponding cell.
+     */
+    Cell cell() const;
+
+    /**
+     * @param k any coordinate.
+     * @return the Khalimsky coordinate [k] of the cell.
+     */
+    Integer uKCoord( Dimension k ) const;
+
+    /**
+     * @return the Khalimsky coordinates of the cell.
+     */
+    Point uKCoords() const;
+
+    /**
+     * @return the topology word of the cell (bit k is 1 iff the cell
+     * is open along k), like KhalimskySpaceND::uTopology.
+     */
+    unsigned int uTopology() const;
+
+    /**
+     * @return the dimension of the cell.
+     */
+    Dimension uDim() const;
+
+    /**
+     * @param k any coordinate.
+     * @return 'true' iff the cell is open along [k].
+     */
+    bool uIsOpen( Dimension k ) const;
+
+    /**
+     * @param k any coordinate.
+     * @param up if 'true' the orientation is forward along axis k,
+     * otherwise backward.
+     * @return the adjacent cell along [k], of same topology.
+     */
+    PackedKhalimskyCell uAdjacent( Dimension k, bool up ) const;
+
+    /**
+     * @param k any coordinate.
+     * @param up if 'true' the orientation is forward along axis k,
+     * otherwise backward.
+     * @return the incident cell along [k], whose dimension is one more
+     * or one less.
+     */
+    PackedKhalimskyCell uIncident( Dimension k, bool up ) const;
+
+    /**
+       Equality operator.
+       @param other any other cell.
+    */
+    bool operator==( const PackedKhalimskyCell & other ) const;
+
+    /**
+       Difference operator.
+       @param other any other cell.
+    */
+    bool operator!=( const PackedKhalimskyCell & other ) const;
+
+    /**
+       Inferior operator. (order of the keys).
+       @param other any other cell.
+    */
+    bool operator<( const PackedKhalimskyCell & other ) const;
+
+    /**
+     * @param k any coordinate.
+     * @return the position of the field of coordinate [k].
+     */
+    static unsigned int shift( Dimension k );
+
+  };
+
+  /**
+   * @param cell any packed cell.
+   * @return a hash value of the cell (used by boost::hash).
+   */
+  template < Dimension dim,
+	     typename TInteger >
+  std::size_t
+  hash_value( const PackedKhalimskyCell< dim, TInteger > & cell );
+
+  template < Dimension dim,
+	     typename TInteger >
+  std::ostream &
+  operator<<( std::ostream & out,
+	      const PackedKhalimskyCell< dim, TInteger > & object );
+
+  /**
+     Represents a signed cell in a cellular grid space by a single
+     64-bit key: the key of the unsigned cell (see PackedKhalimskyCell)
+     with the sign in the top bit (1 iff positive).
+
+     The signed services follow the ones of KhalimskySpaceND: the sign
+     of an incident cell is given by the parity of the number of open
+     coordinates up to k, which is the number of bits of the key in
+     topologyMask() below the field of k+1.
+
+     @tparam dim the dimension of the space.
+     @tparam TInteger the type of the coordinates of the cells.
+   */
+  template < Dimension dim,
+	     typename TInteger = DGtal::int32_t >
+  struct PackedSignedKhalimskyCell
+  {
+  public:
+    typedef TInteger Integer;
+    typedef DGtal::uint64_t Key;
+    typedef PointVector< dim, Integer > Point;
+    typedef SignedKhalimskyCell< dim, Integer > SCell;
+    typedef PackedKhalimskyCell< dim, Integer > PackedCell;
+
+    /// The bit of the sign.
+    static const Key SIGN = (Key) 1 << 63;
+
+    /// The key of the cell.
+    Key myKey;
+
+    /**
+     * Constructor. The positive cell of null Khalimsky coordinates.
+     */
+    PackedSignedKhalimskyCell();
+
+    /**
+     * Constructor from a signed cell.
+     *
+     * @param scell any signed cell whose Khalimsky coordinates lie in
+     * [PackedCell::minKCoord(),PackedCell::maxKCoord()].
+     */
+    explicit PackedSignedKhalimskyCell( const SCell & scell );
+
+    /**
+     * Constructor from Khalimsky coordinates and sign.
+     *
+     * @param kp any point of Khalimsky coordinates.
+     * @param positive 'true' if the cell has positive sign.
+     */
+    PackedSignedKhalimskyCell( const Point & kp, bool positive );
+
+    /**
+     * Constructor from an unsigned cell and a sign.
+     *
+     * @param c any packed cell.
+     * @param positive 'true' if the cell has positive sign.
+     */
+    PackedSignedKhalimskyCell( const PackedCell & c, bool positive );
+
+    /**
+     * @param key any key of a signed cell.
+     * @return the cell of key [key].
+     */
+    static PackedSignedKhalimskyCell fromKey( Key key );
+
+    /**
+     * @return the corresponding signed cell.
+     */
+    SCell scell() const;
+
+    /**
+     * @return the unsigned cell.
+     */
+    PackedCell unsigns() const;
+
+    /**
+     * @param k any coordinate.
+     * @return the Khalimsky coordinate [k] of the cell.
+     */
+    Integer sKCoord( Dimension k ) const;
+
+    /**
+     * @return the Khalimsky coordinates of the cell.
+     */
+    Point sKCoords() const;
+
+    /**
+     * @return the dimension of the cell.
+     */
+    Dimension sDim() const;
+
+    /**
+     * @param k any coordinate.
+     * @return 'true' iff the cell is open along [k].
+     */
+    bool sIsOpen( Dimension k ) const;
+
+    /**
+     * @return 'true' iff the cell is positive.
+     */
+    bool sSign() const;
+
+    /**
+     * @return the cell with the opposite sign.
+     */
+    PackedSignedKhalimskyCell sOpp() const;
+
+    /**
+     * @param k any coordinate.
+     * @param up if 'true' the orientation is forward along axis k,
+     * otherwise backward.
+     * @return the adjacent cell along [k], with the same sign.
+     */
+    PackedSignedKhalimskyCell sAdjacent( Dimension k, bool up ) const;
+
+    /**
+     * @param k any coordinate.
+     * @param up if 'true' the orientation is forward along axis k,
+     * otherwise backward.
+     * @return the incident cell along [k], signed like
+     * KhalimskySpaceND::sIncident.
+     */
+    PackedSignedKhalimskyCell sIncident( Dimension k, bool up ) const;
+
+    /**
+     * @param k any coordinate.
+     * @return the direct orientation of the cell along [k], like
+     * KhalimskySpaceND::sDirect.
+     */
+    bool sDirect( Dimension k ) const;
+
+    /**
+     * @param k any coordinate.
+     * @return the direct incident cell along [k] (which is positive).
+     */
+    PackedSignedKhalimskyCell sDirectIncident( Dimension k ) const;
+
+    /**
+     * @param k any coordinate.
+     * @return the indirect incident cell along [k] (which is negative).
+     */
+    PackedSignedKhalimskyCell sIndirectIncident( Dimension k ) const;
+
+    /**
+       Equality operator.
+       @param other any other cell.
+    */
+    bool operator==( const PackedSignedKhalimskyCell & other ) const;
+
+    /**
+       Difference operator.
+       @param other any other cell.
+    */
+    bool operator!=( const PackedSignedKhalimskyCell & other ) const;
+
+    /**
+       Inferior operator. (order of the keys).
+       @param other any other cell.
+    */
+    bool operator<( const PackedSignedKhalimskyCell & other ) const;
+
+  };
+
+  /**
+   * @param cell any packed signed cell.
+   * @return a hash value of the cell (used by boost::hash).
+   */
+  template < Dimension dim,
+	     typename TInteger >
+  std::size_t
+  hash_value( const PackedSignedKhalimskyCell< dim, TInteger > & cell );
+
+  template < Dimension dim,
+	     typename TInteger >
+  std::ostream &
+  operator<<( std::ostream & out,
+	      const PackedSignedKhalimskyCell< dim, TInteger > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedKhalimskyCell.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedKhalimskyCell_h
+
+#undef PackedKhalimskyCell_RECURSES
+#endif // else defined(PackedKhalimskyCell_RECURSES)
@@ -0,0 +1,305 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SimplePointTable.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module SimplePointTable.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SimplePointTable_RECURSES)
+#error Recursive header files inclusion detected in SimplePointTable.h
+#else // defined(SimplePointTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SimplePointTable_RECURSES
+
+#if !defined SimplePointTable_h
+/** Prevents repeated inclusion of headers. */
+#define SimplePointTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DigitalTopology.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SimplePointTable
+  /**
+   * Description of template class 'SimplePointTable' <p> \brief Aim:
+   * Decides whether a point is simple from the configuration of its
+   * 3^n neighborhood, without building any geodesic neighborhood.
+   *
+   * Only the digital topologies made of two metric adjacencies in
+   * dimension 2 or 3 are handled, as tells the constant [available];
+   * this generic class is the unavailable case. Object::isSimple uses
+   * this class whenever it is available.
+   *
+   * @tparam TDigitalTopology any digital topology.
+   * @see Object::isSimple
+   */
+  template <typename TDigitalTopology>
+  class SimplePointTable
+  {
+  public:
+    /// 'true' iff this digital topology is handled by the table.
+    static const bool available = false;
+  }; // end of class SimplePointTable
+
+  /**
+   * Description of template class 'SimplePointTable' <p> \brief Aim:
+   * Decides whether a point is simple for a (kappa,lambda) topology
+   * made of two metric adjacencies, from the configuration of its
+   * 3^n neighborhood (n=2 or 3).
+   *
+   * A configuration is a bit mask whose bit c is set iff the c-th
+   * point of the neighborhood belongs to the set, the points being
+   * numbered like in a HyperRectDomain (first coordinate varying
+   * fastest), so that the central point is the bit (3^n-1)/2. The
+   * geodesic neighborhoods of Object::geodesicNeighborhood and
+   * Object::geodesicNeighborhoodInComplement are computed as
+   * dilations of bit masks along the precomputed adjacency masks of
+   * each bit, and their connectedness by a flood fill of bit masks,
+   * so that the result is the one of the generic definition.
+   *
+   * In 2D, all the 2^9 configurations are evaluated when the table is
+   * first used, and the simplicity test becomes a lookup in a
+   * bitset. In 3D, the configurations where the central point belongs
+   * to the set are the ones met when thinning, and they only depend
+   * on the 26 other bits. They are memoized in a table of 2^26
+   * entries of 2 bits (unknown, not simple, simple), i.e. 16MB, which
+   * is filled as the configurations are met. The other configurations
+   * are evaluated with the bit masks. The table may be queried
+   * concurrently by OpenMP threads.
+   *
+   * The configuration of a point is read by visiting its neighborhood
+   * with the MetricStencil of the 3^n neighborhood, which moves a
+   * single point instead of building each neighbor.
+   *
+   * @code
+   * typedef SimplePointTable<Z3i::DT26_6> Table;
+   * const Table & table = Table::instance();
+   * bool simple = table.isSimple( table.configuration( set, p ) );
+   * @endcode
+   *
+   * @tparam TSpace any digital space.
+   * @tparam kappaN the maxNorm1 of the foreground adjacency.
+   * @tparam lambdaN the maxNorm1 of the background adjacency.
+   * @tparam dim the dimension of the space.
+   */
+  template <typename TSpace, Dimension kappaN, Dimension lambdaN,
+	    Dimension dim>
+  class SimplePointTable< DigitalTopology< MetricAdjacency<TSpace,kappaN,dim>,
+					   MetricAdjacency<TSpace,lambdaN,dim> > >
+  {
+  public:
+    typedef typename TSpace::Point Point;
+    /// A set of points of the neighborhood, one bit per point.
+    typedef DGtal::uint32_t Configuration;
+
+    /// 'true' iff this digital topology is handled by the table.
+    static const bool available = ( dim == 2 ) || ( dim == 3 );
+    /// The number of points of the 3^n neighborhood.
+    static const unsigned int size = ( dim == 2 ) ? 9 : 27;
+    /// The bit of the central point.
+    static const unsigned int center = size / 2;
+    /// The stencil of the 3^n neighborhood, in the order of the bits.
+    typedef typename MetricAdjacency<TSpace,dim,dim>::Stencil Stencil;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * The table is built at its first use.
+     * @return the unique instance of the table.
+     */
+    static const SimplePointTable & instance();
+
+    /**
+     * Destructor.
+     */
+    ~SimplePointTable();
+
+    /**
+     * @tparam TDigitalSet any model of CDigitalSet.
+     * @param set any digital set.
+     * @param p any point.
+     * @return the configuration of [set] in the neighborhood of [p].
+     */
+    template <typename TDigitalSet>
+    Configuration configuration( const TDigitalSet & set,
+				 const Point & p ) const;
+
+    /**
+     * @param c any configuration.
+     * @return 'true' iff the central point is simple for [c]. In 3D,
+     * the result is memoized when the central point is in [c].
+     */
+    bool isSimple( Configuration c ) const;
+
+    /**
+     * Evaluates the simplicity of the central point without looking
+     * up the table.
+     *
+     * @param c any configuration.
+     * @return 'true' iff the central point is simple for [c].
+     */
+    bool computeIsSimple( Configuration c ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The displacement from the central point to each point.
+    Point myOffsets[ size ];
+    /// The points that are kappa-adjacent to each point, itself excluded.
+    Configuration myKappaMasks[ size ];
+    /// The points that are lambda-adjacent to each point, itself excluded.
+    Configuration myLambdaMasks[ size ];
+    /// The simplicity of each configuration (2D only).
+    std::vector<bool> myTable;
+    /// The memoized simplicity of the configurations containing the
+    /// central point, 2 bits per configuration of the 26 other points,
+    /// 0 when not yet evaluated (3D only).
+    mutable std::vector<DGtal::uint32_t> myMemo;
+
+    /// The memo entry of a configuration that is not simple.
+    static const DGtal::uint32_t NOT_SIMPLE = 2;
+    /// The memo entry of a configuration that is simple.
+    static const DGtal::uint32_t SIMPLE = 3;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Constructor. Computes the masks and, in 2D, the table. In 3D,
+     * the memo is allocated empty.
+     */
+    SimplePointTable();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    SimplePointTable ( const SimplePointTable & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SimplePointTable & operator= ( const SimplePointTable & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param c any set of points.
+     * @param masks the adjacency masks.
+     * @return the points adjacent to a point of [c].
+     */
+    static Configuration dilation( Configuration c,
+				   const Configuration * masks );
+
+    /**
+     * @param c any set of points.
+     * @param masks the adjacency masks.
+     * @return 'true' iff [c] is non-empty and connected.
+     */
+    static bool isConnected( Configuration c, const Configuration * masks );
+
+    /**
+     * Functor visited by the stencil, which sets the bit of each point
+     * of the neighborhood that belongs to the set.
+     *
+     * @tparam TDigitalSet any model of CDigitalSet.
+     */
+    template <typename TDigitalSet>
+    struct ConfigurationReader
+    {
+      const TDigitalSet & mySet;
+      const typename TDigitalSet::ConstIterator myEnd;
+      Configuration myConfiguration;
+      Configuration myBit;
+      ConfigurationReader( const TDigitalSet & set )
+	: mySet( set ), myEnd( set.end() ), myConfiguration( 0 ), myBit( 1 )
+      {}
+      void operator()( const Point & q )
+      {
+	if ( mySet.find( q ) != myEnd ) myConfiguration |= myBit;
+	myBit <<= 1;
+      }
+    };
+
+  }; // end of class SimplePointTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SimplePointTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SimplePointTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, Dimension kappaN, Dimension lambdaN,
+	    Dimension dim>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const SimplePointTable
+	       < DigitalTopology< MetricAdjacency<TSpace,kappaN,dim>,
+	       MetricAdjacency<TSpace,lambdaN,dim> > > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SimplePointTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SimplePointTable_h
+
+#undef SimplePointTable_RECURSES
+#endif // else defined(SimplePointTable_RECURSES)
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -221,7 +222,8 @@ namespace DGtal
     /**
        Go to the next direct or indirect adjacent bel on the boundary
        of some digital [obj].  The boundary may be open (it touches
-       the space borders).
+       the space borders). Same as getAdjacentOnPointPredicate with
+       the predicate of the points of [obj].
 
        @tparam DigitalSet any model of digital set, i.e. a set of
        digital points, having 'find( const Point & ) : const_iterator'.
@@ -243,6 +245,31 @@ namespace DGtal
 					  Dimension track_dir,
 					  bool pos ) const;
 
+    /**
+       Go to the next direct or indirect adjacent bel on the boundary
+       of the digital shape given by the predicate [pp]. The boundary
+       may be open (it touches the space borders).
+
+       @tparam PointPredicate any functor 'operator()( const Point & )
+       : bool' telling whether a digital point belongs to the shape.
+
+       @param adj_surfel (returns) the signed adjacent surfel in direction
+       [track_dir] if there is one.
+       @param pp the predicate of the points of the shape.
+       @param track_dir the direction where to look for the spel.
+       @param pos when 'true' look in positive direction along
+       [track_dir] axis, 'false' look in negative direction.
+
+       @return 0 if the move was impossible (no bels in this direction),
+       1 if it was the first interior, 2 if it was the second interior,
+       3 if it was the third interior.
+    */
+    template <typename PointPredicate>
+    unsigned int getAdjacentOnPointPredicate( SCell & adj_surfel,
+					      const PointPredicate & pp,
+					      Dimension track_dir,
+					      bool pos ) const;
+
 
     // ----------------------- Interface --------------------------------------
   public:
@@ -0,0 +1,293 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelSet.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module SurfelSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelSet_RECURSES)
+#error Recursive header files inclusion detected in SurfelSet.h
+#else // defined(SurfelSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelSet_RECURSES
+
+#if !defined SurfelSet_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/PackedKhalimskyCell.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelSet
+  /**
+   * Description of template class 'SurfelSet' <p> \brief Aim: A set of
+   * signed cells (typically the surfels of a boundary), stored as
+   * packed keys, with the services of std::set needed by
+   * Surfaces::trackBoundary.
+   *
+   * The cells are stored in insertion order as the keys of
+   * PackedSignedKhalimskyCell. Membership is answered either by an
+   * open addressing hash table (linear probing) of indices into the
+   * keys, which is rehashed when half full, or, when the space is not
+   * too large, by a bitmap holding the index into the keys of each
+   * signed cell of the space. In both cases, insert(), count() and
+   * find() do a single lookup, and insert() returns the position of
+   * the cell and whether it was new, like std::set::insert.
+   *
+   * @code
+   * SurfelSet<Z3i::KSpace> bdry( K );
+   * Surfaces<Z3i::KSpace>::trackBoundary( bdry, K, SAdj, shape, bel );
+   * @endcode
+   *
+   * @tparam TKSpace the type of cellular grid space, a
+   * KhalimskySpaceND whose Khalimsky coordinates lie in the range of
+   * PackedKhalimskyCell.
+   */
+  template <typename TKSpace>
+  class SurfelSet
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Size Size;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef PackedSignedKhalimskyCell< KSpace::dimension, Integer > PackedSCell;
+    typedef typename PackedSCell::Key Key;
+    typedef SCell value_type;
+    typedef SCell key_type;
+
+    /**
+     * Read-only iterator on the cells of the set, in insertion order.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef SCell value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const SCell * pointer;
+      typedef SCell reference;
+
+      ConstIterator() {}
+      explicit ConstIterator( typename std::vector<Key>::const_iterator it )
+	: myIt( it ) {}
+      SCell operator*() const
+      { return PackedSCell::fromKey( *myIt ).scell(); }
+      ConstIterator & operator++() { ++myIt; return *this; }
+      ConstIterator operator++( int )
+      { ConstIterator tmp( *this ); ++myIt; return tmp; }
+      bool operator==( const ConstIterator & other ) const
+      { return myIt == other.myIt; }
+      bool operator!=( const ConstIterator & other ) const
+      { return myIt != other.myIt; }
+      /// @return the packed key of the current cell.
+      Key key() const { return *myIt; }
+
+    private:
+      typename std::vector<Key>::const_iterator myIt;
+    };
+    typedef ConstIterator Iterator;
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The set is empty.
+     *
+     * @param K the cellular grid space of the cells.
+     * @param useBitmap when 'true', membership is stored in a bitmap of
+     * 2 indices per cell of [K] (one per sign), otherwise in a hash
+     * table.
+     */
+    SurfelSet( const KSpace & K, bool useBitmap = false );
+
+    /**
+     * Destructor.
+     */
+    ~SurfelSet();
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /**
+     * @return the number of cells in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty.
+     */
+    bool empty() const;
+
+    /**
+     * Removes all the cells, keeping the allocated memory.
+     */
+    void clear();
+
+    /**
+     * Inserts a cell.
+     *
+     * @param c any signed cell of the space.
+     * @return an iterator on [c] in the set and 'true' iff [c] was not
+     * already in the set.
+     */
+    std::pair<ConstIterator,bool> insert( const SCell & c );
+
+    /**
+     * Inserts the cells of a range.
+     *
+     * @tparam SCellConstIterator any input iterator on signed cells.
+     * @param b the beginning of the range.
+     * @param e the end of the range.
+     */
+    template <typename SCellConstIterator>
+    void insert( SCellConstIterator b, SCellConstIterator e );
+
+    /**
+     * @param c any signed cell of the space.
+     * @return 1 if [c] is in the set, 0 otherwise.
+     */
+    Size count( const SCell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return an iterator on [c] if [c] is in the set, end() otherwise.
+     */
+    ConstIterator find( const SCell & c ) const;
+
+    /**
+     * @return an iterator on the first inserted cell.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last inserted cell.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return 'true' iff membership is stored in a bitmap.
+     */
+    bool usesBitmap() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The keys of the cells, in insertion order.
+    std::vector<Key> myKeys;
+    /// The hash table of indices into myKeys (hash mode).
+    std::vector<DGtal::uint32_t> myTable;
+    /// The index into myKeys of each signed cell of the space, or
+    /// EMPTY (bitmap mode).
+    std::vector<DGtal::uint32_t> myBitmap;
+    /// The lowest Khalimsky coordinates of the space (bitmap mode).
+    Point myKLower;
+    /// The index distance between consecutive cells along each axis
+    /// (bitmap mode).
+    std::vector<Size> myStrides;
+    /// 'true' iff membership is stored in myBitmap.
+    bool myUseBitmap;
+
+    /// The empty slots of myTable and myBitmap.
+    static const DGtal::uint32_t EMPTY = 0xffffffff;
+    /// The initial number of slots of myTable.
+    static const Size INITIAL_TABLE_SIZE = 64;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param key the key of any cell.
+     * @return the slot of myTable holding [key], or the empty slot
+     * where it should be inserted.
+     */
+    Size slot( Key key ) const;
+
+    /**
+     * Doubles the number of slots of myTable and reinserts the keys.
+     */
+    void grow();
+
+    /**
+     * @param pc any packed cell of the space.
+     * @return the index of [pc] in myBitmap.
+     */
+    Size bitIndex( const PackedSCell & pc ) const;
+
+  }; // end of class SurfelSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfelSet<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SurfelSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelSet_h
+
+#undef SurfelSet_RECURSES
+#endif // else defined(SurfelSet_RECURSES)
@@ -80,6 +80,14 @@ bool testParametricShape()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
 	       << "true == true" << std::endl;
+
+  Z2i::DigitalSet set2(domain);
+  Shapes<Z2i::Domain>::shaper( set2,
+			       Ball2D<Z2i::Space>( cc, 10), 4 );
+  nbok += ( set2.size() == set.size() ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "shaper with 4 threads, size=" << set2.size() << std::endl;
   trace.endBlock();
   
   return nbok == nb;
@@ -35,6 +35,7 @@
  */
 
 #include <cstdio>
+#include <cstdlib>
 #include <cmath>
 #include <iostream>
 #include <fstream>
@@ -47,6 +48,9 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetBySortedSTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByHashSet.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -277,6 +281,416 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+bool testDigitalSetBySortedSTLVector()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> Z2;
+  typedef HyperRectDomain<Z2> Domain;
+  typedef Z2::Point Point;
+  typedef DigitalSetBySortedSTLVector<Domain> SortedSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  Point p1(  -10, -10  );
+  Point p2(  10, 10  );
+  Domain domain( p1, p2 );
+
+  trace.beginBlock ( "Batched insertion in sorted vector ..." );
+  std::vector<Point> points;
+  for ( Domain::ConstIterator it = domain.range().begin();
+	it != domain.range().end(); ++it )
+    if ( ( (*it)[0] + 2 * (*it)[1] ) % 3 == 0 )
+      points.push_back( *it );
+  std::reverse( points.begin(), points.end() );
+  SortedSet set1( domain );
+  RefSet ref1( domain );
+  set1.insert( points.begin(), points.end() );
+  set1.insert( points.begin(), points.begin() + 10 );
+  ref1.insert( points.begin(), points.end() );
+  INBLOCK_TEST( set1.isValid() );
+  INBLOCK_TEST( set1.size() == ref1.size() );
+  INBLOCK_TEST( std::equal( set1.begin(), set1.end(), ref1.begin() ) );
+  INBLOCK_TEST( set1.find( Point( 0, 0 ) ) != set1.end() );
+  INBLOCK_TEST( set1.find( Point( 1, 0 ) ) == set1.end() );
+  trace.endBlock();
+
+  trace.beginBlock ( "Set operations on sorted vectors ..." );
+  SortedSet set2( domain );
+  for ( Domain::ConstIterator it = domain.range().begin();
+	it != domain.range().end(); ++it )
+    if ( (*it)[0] >= 0 )
+      set2.insertNew( *it );
+  SortedSet u( set1 );
+  u += set2;
+  SortedSet d( set1 );
+  d -= set2;
+  SortedSet i( set1 );
+  i *= set2;
+  INBLOCK_TEST( u.isValid() && d.isValid() && i.isValid() );
+  INBLOCK_TEST( u.size() == d.size() + set2.size() );
+  INBLOCK_TEST( set1.size() == d.size() + i.size() );
+  SortedSet c = set1.computeComplement();
+  INBLOCK_TEST( c.isValid() );
+  INBLOCK_TEST( c.size() + set1.size() == 21 * 21 );
+  c *= set1;
+  INBLOCK_TEST( c.empty() );
+  set1.erase( Point( 0, 0 ) );
+  INBLOCK_TEST( set1.find( Point( 0, 0 ) ) == set1.end() && set1.isValid() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testDigitalSetByHashSet()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<3> Z3;
+  typedef HyperRectDomain<Z3> Domain;
+  typedef Z3::Point Point;
+  typedef DigitalSetByHashSet<Domain> HashSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  Point p1(  -8, -8, -8  );
+  Point p2(  8, 8, 8  );
+  Domain domain( p1, p2 );
+
+  trace.beginBlock ( "Insertions and removals in hash set ..." );
+  std::vector<Point> points;
+  for ( Domain::ConstIterator it = domain.range().begin();
+	it != domain.range().end(); ++it )
+    if ( ( (*it)[0] + 2 * (*it)[1] + 3 * (*it)[2] ) % 4 == 0 )
+      points.push_back( *it );
+  HashSet set1( domain );
+  RefSet ref1( domain );
+  set1.insert( points.begin(), points.end() );
+  set1.insert( points.begin(), points.begin() + 10 );
+  ref1.insert( points.begin(), points.end() );
+  INBLOCK_TEST( set1.isValid() );
+  INBLOCK_TEST( set1.size() == ref1.size() );
+  unsigned int nbfound = 0;
+  for ( RefSet::ConstIterator it = ref1.begin(); it != ref1.end(); ++it )
+    nbfound += ( set1.find( *it ) != set1.end() ) ? 1 : 0;
+  INBLOCK_TEST( nbfound == ref1.size() );
+  for ( unsigned int i = 0; i < points.size(); i += 3 )
+    {
+      set1.erase( points[ i ] );
+      ref1.erase( points[ i ] );
+    }
+  INBLOCK_TEST( set1.isValid() );
+  INBLOCK_TEST( set1.size() == ref1.size() );
+  nbfound = 0;
+  for ( HashSet::ConstIterator it = set1.begin(); it != set1.end(); ++it )
+    nbfound += ( ref1.find( *it ) != ref1.end() ) ? 1 : 0;
+  INBLOCK_TEST( nbfound == ref1.size() );
+  INBLOCK_TEST( set1.find( points[ 0 ] ) == set1.end() );
+  INBLOCK_TEST( set1.find( Point( 1, 0, 0 ) ) == set1.end() );
+  // Inserting points already in the set never grows the table.
+  HashSet full( domain );
+  full.insert( points[ 0 ] );
+  while ( 10 * ( full.size() + 1 ) < 7 * full.capacity() )
+    full.insert( points[ full.size() ] );
+  HashSet::Size capacity = full.capacity();
+  for ( HashSet::ConstIterator it = full.begin(); it != full.end(); ++it )
+    full.insert( *it );
+  INBLOCK_TEST( full.capacity() == capacity );
+  trace.endBlock();
+
+  trace.beginBlock ( "Erasing points while traversing a hash set ..." );
+  HashSet set2( set1 );
+  RefSet ref2( domain );
+  unsigned int nbvisited = 0;
+  for ( HashSet::Iterator it = set2.begin(); it != set2.end(); ++nbvisited )
+    if ( ( (*it)[ 0 ] + (*it)[ 1 ] ) % 2 == 0 ) set2.erase( it++ );
+    else ref2.insert( *it++ );
+  INBLOCK_TEST( nbvisited == set1.size() );
+  INBLOCK_TEST( set2.isValid() );
+  INBLOCK_TEST( set2.size() == ref2.size() );
+  set2.insert( points.begin(), points.end() );
+  INBLOCK_TEST( set2.isValid() && ( set2.size() == points.size() ) );
+  trace.endBlock();
+
+  trace.beginBlock ( "Set operations on hash sets ..." );
+  HashSet c = set1.computeComplement();
+  INBLOCK_TEST( c.isValid() );
+  INBLOCK_TEST( c.size() + set1.size() == 17 * 17 * 17 );
+  c += set1;
+  INBLOCK_TEST( c.size() == 17 * 17 * 17 );
+  c.erase( c.begin(), c.end() );
+  INBLOCK_TEST( c.empty() && c.isValid() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testDigitalSetByRuns()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<3> Z3;
+  typedef HyperRectDomain<Z3> Domain;
+  typedef Z3::Point Point;
+  typedef DigitalSetByRuns<Domain> RunSet;
+  typedef DigitalSetBySTLSet<Domain> RefSet;
+  Point p1(  -8, -8, -8  );
+  Point p2(  8, 8, 8  );
+  Domain domain( p1, p2 );
+
+  trace.beginBlock ( "Insertions and removals in run set ..." );
+  std::vector<Point> points;
+  for ( Domain::ConstIterator it = domain.range().begin();
+	it != domain.range().end(); ++it )
+    if ( (*it).norm() <= 6.0 )
+      points.push_back( *it );
+  RunSet set1( domain );
+  RefSet ref1( domain );
+  set1.insert( points.rbegin(), points.rend() );
+  ref1.insert( points.begin(), points.end() );
+  INBLOCK_TEST( set1.isValid() );
+  INBLOCK_TEST( set1.size() == ref1.size() );
+  INBLOCK_TEST( set1.nbRuns() < set1.size() / 5 );
+  INBLOCK_TEST( std::equal( set1.begin(), set1.end(), points.begin() ) );
+  RunSet set2( domain );
+  for ( std::vector<Point>::const_iterator it = points.begin();
+	it != points.end(); ++it )
+    set2.insert( *it );
+  INBLOCK_TEST( set2.isValid() && set2.nbRuns() == set1.nbRuns() );
+  for ( unsigned int i = 0; i < points.size(); i += 3 )
+    {
+      set1.erase( points[ i ] );
+      ref1.erase( points[ i ] );
+    }
+  INBLOCK_TEST( set1.isValid() );
+  INBLOCK_TEST( set1.size() == ref1.size() );
+  unsigned int nbfound = 0;
+  for ( RunSet::ConstIterator it = set1.begin(); it != set1.end(); ++it )
+    nbfound += ( ref1.find( *it ) != ref1.end() ) ? 1 : 0;
+  INBLOCK_TEST( nbfound == ref1.size() );
+  INBLOCK_TEST( set1.find( points[ 0 ] ) == set1.end() );
+  INBLOCK_TEST( *set1.find( points[ 1 ] ) == points[ 1 ] );
+  trace.endBlock();
+
+  trace.beginBlock ( "Set operations on run sets ..." );
+  RunSet c = set1.computeComplement();
+  INBLOCK_TEST( c.isValid() );
+  INBLOCK_TEST( c.size() + set1.size() == 17 * 17 * 17 );
+  INBLOCK_TEST( c.find( points[ 0 ] ) != c.end() );
+  c += set1;
+  INBLOCK_TEST( c.isValid() && c.size() == 17 * 17 * 17 );
+  INBLOCK_TEST( c.nbRuns() == 17 * 17 );
+  trace.info() << c << std::endl;
+  Point lower, upper;
+  set2.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( -6, -6, -6 ) && upper == Point( 6, 6, 6 ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks union, difference, intersection and complement of a model of
+ * digital set against the sorted vector representation.
+ */
+template < typename DigitalSetType >
+bool testDigitalSetAlgebra( const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<3> Z3;
+  typedef HyperRectDomain<Z3> Domain;
+  typedef Z3::Point Point;
+  typedef DigitalSetBySortedSTLVector<Domain> RefSet;
+  Point p1(  -6, -6, -6  );
+  Point p2(  6, 6, 6  );
+  Domain domain( p1, p2 );
+
+  trace.beginBlock ( "Set algebra on " + name + " ..." );
+  DigitalSetType a( domain );
+  DigitalSetType b( domain );
+  RefSet ra( domain );
+  RefSet rb( domain );
+  for ( Domain::ConstIterator it = domain.range().begin();
+	it != domain.range().end(); ++it )
+    {
+      if ( (*it).norm() <= 5.0 )
+	{ a.insert( *it ); ra.insert( *it ); }
+      if ( ( (*it)[0] + (*it)[1] ) % 3 != 0 )
+	{ b.insert( *it ); rb.insert( *it ); }
+    }
+  DigitalSetType u( a ); u += b;
+  DigitalSetType d( a ); d -= b;
+  DigitalSetType i( a ); i *= b;
+  DigitalSetType c( domain ); c.assignFromComplement( a );
+  RefSet ru( ra ); ru += rb;
+  RefSet rd( ra ); rd -= rb;
+  RefSet ri( ra ); ri *= rb;
+  RefSet rc = ra.computeComplement();
+  INBLOCK_TEST( u.size() == ru.size() );
+  INBLOCK_TEST( d.size() == rd.size() );
+  INBLOCK_TEST( i.size() == ri.size() );
+  INBLOCK_TEST( c.size() == rc.size() );
+  RefSet check( domain );
+  check.insert( d.begin(), d.end() );
+  INBLOCK_TEST( std::equal( check.begin(), check.end(), rd.begin() ) );
+  check.clear();
+  check.insert( i.begin(), i.end() );
+  INBLOCK_TEST( std::equal( check.begin(), check.end(), ri.begin() ) );
+  check.clear();
+  check.insert( c.begin(), c.end() );
+  INBLOCK_TEST( std::equal( check.begin(), check.end(), rc.begin() ) );
+  d -= d;
+  INBLOCK_TEST( d.empty() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks the complement of a set whose points lie partly outside the
+ * domain of the complement.
+ */
+template < typename DigitalSetType >
+bool testDigitalSetComplementOutside( const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> Z2;
+  typedef HyperRectDomain<Z2> Domain;
+  typedef Z2::Point Point;
+  Domain domain( Point( 0, 0 ), Point( 3, 3 ) );
+  Domain big_domain( Point( -1, -1 ), Point( 5, 5 ) );
+
+  trace.beginBlock ( "Complement of a set outside the domain on "
+		     + name + " ..." );
+  DigitalSetType other( big_domain );
+  other.insert( Point( -1, 0 ) );
+  other.insert( Point( 1, 1 ) );
+  other.insert( Point( 1, 5 ) );
+  other.insert( Point( 2, 2 ) );
+  other.insert( Point( 5, 2 ) );
+  DigitalSetType c( domain );
+  c.assignFromComplement( other );
+  INBLOCK_TEST( c.size() == 14 );
+  INBLOCK_TEST( c.find( Point( 1, 1 ) ) == c.end() );
+  INBLOCK_TEST( c.find( Point( 2, 2 ) ) == c.end() );
+  INBLOCK_TEST( c.find( Point( 1, 2 ) ) != c.end() );
+  INBLOCK_TEST( c.find( Point( 3, 3 ) ) != c.end() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks the bounding box maintained by a model of digital set
+ * against the box of its points along a sequence of insertions and
+ * erasures.
+ */
+template < typename DigitalSetType >
+bool testDigitalSetBoundingBox( const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<3> Z3;
+  typedef HyperRectDomain<Z3> Domain;
+  typedef Z3::Point Point;
+  typedef typename DigitalSetType::ConstIterator ConstIterator;
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+
+  trace.beginBlock ( "Bounding box of " + name + " ..." );
+  DigitalSetType a( domain );
+  Point lower, upper;
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == domain.upperBound() && upper == domain.lowerBound() );
+  srand( 3 );
+  bool ok = true;
+  for ( unsigned int i = 0; i < 300; ++i )
+    {
+      Point p( rand() % 21 - 10, rand() % 21 - 10, rand() % 21 - 10 );
+      if ( rand() % 3 == 0 ) a.erase( p );
+      else a.insert( p );
+      if ( a.empty() ) continue;
+      Point refLower( *a.begin() ), refUpper( *a.begin() );
+      for ( ConstIterator it = a.begin(); it != a.end(); ++it )
+	{
+	  refLower = refLower.inf( *it );
+	  refUpper = refUpper.sup( *it );
+	}
+      a.computeBoundingBox( lower, upper );
+      ok = ok && ( lower == refLower ) && ( upper == refUpper );
+    }
+  INBLOCK_TEST2( ok, "random insertions and erasures" );
+  a.clear();
+  a.insert( Point( 0, 0, 0 ) );
+  a.insert( Point( 2, -1, 3 ) );
+  a.insert( Point( 1, 1, 1 ) );
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, -1, 0 ) && upper == Point( 2, 1, 3 ) );
+  a.erase( Point( 2, -1, 3 ) );
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, 0, 0 ) && upper == Point( 1, 1, 1 ) );
+  DigitalSetType b( domain );
+  b.insert( Point( -4, 5, 0 ) );
+  a += b;
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( -4, 0, 0 ) && upper == Point( 1, 5, 1 ) );
+  a -= b;
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, 0, 0 ) && upper == Point( 1, 1, 1 ) );
+  std::vector<Point> range;
+  range.push_back( Point( 3, 0, -2 ) );
+  range.push_back( Point( 0, 7, 0 ) );
+  a.insert( range.begin(), range.end() );
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, 0, -2 ) && upper == Point( 3, 7, 1 ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Points of a DigitalSetBySTLVector may be modified through its
+ * mutable iterators, the bounding box must follow.
+ */
+bool testDigitalSetBySTLVectorIteratorBoundingBox()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> Z2;
+  typedef HyperRectDomain<Z2> Domain;
+  typedef Z2::Point Point;
+  typedef DigitalSetBySTLVector<Domain> DigitalSet;
+  Domain domain( Point( -10, -10 ), Point( 10, 10 ) );
+
+  trace.beginBlock ( "Bounding box of DigitalSetBySTLVector through mutable iterators ..." );
+  DigitalSet a( domain );
+  a.insert( Point( 0, 0 ) );
+  a.insert( Point( 1, 1 ) );
+  a.insert( Point( 5, -3 ) );
+  Point lower, upper;
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, -3 ) && upper == Point( 5, 1 ) );
+  unsigned int n = 0;
+  for ( DigitalSet::Iterator it = a.begin(), itE = a.end(); it != itE; ++it )
+    ++n;
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( n == 3 && lower == Point( 0, -3 ) && upper == Point( 5, 1 ) );
+  a.erase( a.find( Point( 5, -3 ) ) );
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( 0, 0 ) && upper == Point( 1, 1 ) );
+  a.erase( a.begin(), a.end() );
+  a.insert( Point( -2, 4 ) );
+  a.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == Point( -2, 4 ) && upper == Point( -2, 4 ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   //  BOOST_CONCEPT_ASSERT(( CDigitalSet<Z2i::DigitalSet> ));
@@ -310,6 +724,48 @@ int main()
   bool okSet = testDigitalSet< DigitalSetBySTLSet<Domain> >( domain );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetBySortedSTLVector" );
+  bool okSortedVector = testDigitalSet< DigitalSetBySortedSTLVector<Domain> >( domain )
+    && testDigitalSetBySortedSTLVector();
+  trace.endBlock();
+
+  trace.beginBlock( "DigitalSetByHashSet" );
+  bool okHashSet = testDigitalSet< DigitalSetByHashSet<Domain> >( domain )
+    && testDigitalSetByHashSet();
+  trace.endBlock();
+
+  trace.beginBlock( "DigitalSetByRuns" );
+  bool okRuns = testDigitalSet< DigitalSetByRuns<Domain> >( domain )
+    && testDigitalSetByRuns();
+  trace.endBlock();
+
+  bool okAlgebra =
+    testDigitalSetAlgebra< DigitalSetBySTLVector< HyperRectDomain< SpaceND<3> > > >
+    ( "DigitalSetBySTLVector" )
+    && testDigitalSetAlgebra< DigitalSetBySTLSet< HyperRectDomain< SpaceND<3> > > >
+    ( "DigitalSetBySTLSet" )
+    && testDigitalSetAlgebra< DigitalSetByHashSet< HyperRectDomain< SpaceND<3> > > >
+    ( "DigitalSetByHashSet" )
+    && testDigitalSetAlgebra< DigitalSetByRuns< HyperRectDomain< SpaceND<3> > > >
+    ( "DigitalSetByRuns" )
+    && testDigitalSetComplementOutside< DigitalSetBySTLVector< HyperRectDomain< SpaceND<2> > > >
+    ( "DigitalSetBySTLVector" )
+    && testDigitalSetComplementOutside< DigitalSetBySTLSet< HyperRectDomain< SpaceND<2> > > >
+    ( "DigitalSetBySTLSet" )
+    && testDigitalSetComplementOutside< DigitalSetBySortedSTLVector< HyperRectDomain< SpaceND<2> > > >
+    ( "DigitalSetBySortedSTLVector" )
+    && testDigitalSetComplementOutside< DigitalSetByHashSet< HyperRectDomain< SpaceND<2> > > >
+    ( "DigitalSetByHashSet" )
+    && testDigitalSetComplementOutside< DigitalSetByRuns< HyperRectDomain< SpaceND<2> > > >
+    ( "DigitalSetByRuns" );
+
+  bool okBoundingBox =
+    testDigitalSetBoundingBox< DigitalSetBySTLVector< HyperRectDomain< SpaceND<3> > > >
+    ( "DigitalSetBySTLVector" )
+    && testDigitalSetBoundingBox< DigitalSetBySTLSet< HyperRectDomain< SpaceND<3> > > >
+    ( "DigitalSetBySTLSet" )
+    && testDigitalSetBySTLVectorIteratorBoundingBox();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -322,14 +778,20 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorBigHVarHBel = testDigitalSetSelector
+      < Domain, BIG_DS + HIGH_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Big set + High variability + High belonging test" );
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet
+  bool res = okVector && okSet && okSortedVector && okHashSet && okRuns && okAlgebra
+      && okBoundingBox
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
+      && okSelectorBigHVarHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
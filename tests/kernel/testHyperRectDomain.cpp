@@ -35,11 +35,16 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <limits>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomainTraversal.h"
+#include "DGtal/kernel/domains/SpaceFillingCurveRange.h"
+#include "DGtal/kernel/domains/HyperRectDomainLinearizer.h"
+#include "DGtal/topology/MetricAdjacency.h"
 
 
 using namespace DGtal;
@@ -290,11 +295,329 @@ bool testSTLCompat()
 
   return myHyperRectDomain4D.isValid();
 }
+/**
+ * Functor collecting the visited points.
+ */
+template <typename Point>
+struct PointCollector
+{
+  std::vector<Point> points;
+  void operator()( const Point & p )
+  { points.push_back( p ); }
+  template <typename Size>
+  void operator()( const Point & p, Size length )
+  {
+    Point q( p );
+    for ( Size i = 0; i < length; ++i, ++q[ 0 ] )
+      points.push_back( q );
+  }
+};
+
+bool testTraversal()
+{
+  typedef SpaceND<3> TSpace3D;
+  typedef TSpace3D::Point Point3D;
+  typedef HyperRectDomain<TSpace3D> Domain3D;
+  typedef HyperRectDomainTraversal<Domain3D> Traversal;
+  Point3D a( -2, 1, 0 );
+  Point3D b( 3, 4, 2 );
+  Domain3D domain( a, b );
+
+  trace.beginBlock ( "Test unrolled traversal and rows" );
+  std::vector<Point3D> ref( domain.range().begin(), domain.range().end() );
+
+  PointCollector<Point3D> c1 =
+    Traversal::forEach( domain, PointCollector<Point3D>() );
+  bool ok = ( c1.points == ref );
+  trace.info() << "forEach visits " << c1.points.size() << " points." << std::endl;
+
+  PointCollector<Point3D> c2 =
+    Traversal::forEachRow( domain, PointCollector<Point3D>() );
+  ok = ok && ( c2.points == ref );
+
+  Traversal::ConstRowRange rows( domain );
+  PointCollector<Point3D> c3;
+  unsigned int nbRows = 0;
+  for ( Traversal::ConstRowRange::ConstIterator it = rows.begin();
+	it != rows.end(); ++it, ++nbRows )
+    c3( it->start, it->length );
+  ok = ok && ( c3.points == ref )
+    && ( nbRows == rows.size() ) && ( nbRows == 4 * 3 )
+    && ( rows.rowLength() == 6 );
+  trace.info() << "rows=" << nbRows << " length=" << rows.rowLength() << std::endl;
+
+  // Lexicographically ordered bounds that do not define a box.
+  Domain3D empty( Point3D( 0, 5, 0 ), Point3D( 1, 2, 3 ) );
+  Traversal::ConstRowRange emptyRows( empty );
+  ok = ok && ( emptyRows.begin() == emptyRows.end() )
+    && ( Traversal::forEach( empty, PointCollector<Point3D>() ).points.empty() );
+
+  // A box reaching the largest coordinate, where incrementing past
+  // the upper bound would overflow.
+  typedef SpaceND<3, DGtal::int16_t> TSpace16;
+  typedef TSpace16::Point Point16;
+  typedef HyperRectDomain<TSpace16> Domain16;
+  typedef HyperRectDomainTraversal<Domain16> Traversal16;
+  const DGtal::int16_t max16 = std::numeric_limits<DGtal::int16_t>::max();
+  Domain16 border( Point16( max16 - 2, max16 - 1, max16 - 3 ),
+		   Point16( max16, max16, max16 ) );
+  std::vector<Point16> ref16;
+  for ( int z = max16 - 3; z <= max16; ++z )
+    for ( int y = max16 - 1; y <= max16; ++y )
+      for ( int x = max16 - 2; x <= max16; ++x )
+	ref16.push_back( Point16( x, y, z ) );
+  ok = ok && ( ref16.size() == 3 * 2 * 4 )
+    && ( Traversal16::forEach( border, PointCollector<Point16>() ).points
+	 == ref16 )
+    && ( Traversal16::forEachRow( border, PointCollector<Point16>() ).points
+	 == ref16 );
+  trace.info() << "forEach visits " << ref16.size()
+	       << " points up to the largest int16 coordinate." << std::endl;
+  trace.endBlock();
+
+  return ok;
+}
+
+/**
+ * Predicate selecting points whose sum of coordinates is even.
+ */
+struct EvenSum
+{
+  template <typename TPoint>
+  bool operator()( const TPoint & p ) const
+  { return ( ( p[ 0 ] + p[ 1 ] + p[ 2 ] ) % 2 ) == 0; }
+};
 
+/**
+ * Functor marking the visited points in a vector indexed by the
+ * linearization of the point in a domain.
+ */
+template <typename TDomain>
+struct Marker
+{
+  Marker( const TDomain & domain, std::vector<int> & marks )
+    : myDomain( &domain ), myMarks( &marks ) {}
+  void operator()( const typename TDomain::Point & p )
+  {
+    typename TDomain::Point e = myDomain->upperBound() - myDomain->lowerBound();
+    typename TDomain::Point q = p - myDomain->lowerBound();
+    ++(*myMarks)[ q[ 0 ] + ( e[ 0 ] + 1 ) * ( q[ 1 ] + ( e[ 1 ] + 1 ) * q[ 2 ] ) ];
+  }
+  const TDomain* myDomain;
+  std::vector<int>* myMarks;
+};
+
+/**
+ * @return the number of points of a 3D domain.
+ */
+template <typename TDomain>
+int card( const TDomain & domain )
+{
+  typename TDomain::Point e = domain.upperBound() - domain.lowerBound();
+  return ( e[ 0 ] + 1 ) * ( e[ 1 ] + 1 ) * ( e[ 2 ] + 1 );
+}
+
+bool testParallelTraversal()
+{
+  typedef SpaceND<3> TSpace3D;
+  typedef TSpace3D::Point Point3D;
+  typedef HyperRectDomain<TSpace3D> Domain3D;
+  typedef HyperRectDomainTraversal<Domain3D> Traversal;
+  Point3D a( -3, 0, -5 );
+  Point3D b( 4, 6, 7 );
+  Domain3D domain( a, b );
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Test parallel traversal by slabs" );
+  trace.info() << "default threads=" << Traversal::defaultNbThreads() << std::endl;
+
+  // Slabs partition the domain.
+  Traversal::Size nbSlabs = Traversal::nbSlabs( domain, 5 );
+  int nbPoints = 0;
+  for ( Traversal::Size i = 0; i < nbSlabs; ++i )
+    nbPoints += card( Traversal::slab( domain, i, nbSlabs ) );
+  nbok += ( nbSlabs == 5 ) && ( nbPoints == card( domain ) ) ? 1 : 0;
+  nb++;
+  nbok += ( Traversal::nbSlabs( domain, 100 ) == 13 ) ? 1 : 0;
+  nb++;
+
+  std::vector<Point3D> ref;
+  EvenSum pred;
+  for ( Domain3D::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( pred( *it ) ) ref.push_back( *it );
+  for ( unsigned int t = 1; t <= 4; ++t )
+    {
+      std::vector<Point3D> points;
+      Traversal::parallelSelect( domain, pred, points, t );
+      nbok += ( points == ref ) ? 1 : 0;
+      nb++;
+
+      std::vector<int> marks( card( domain ), 0 );
+      Traversal::parallelForEach( domain, Marker<Domain3D>( domain, marks ), t );
+      nbok += ( std::count( marks.begin(), marks.end(), 1 )
+		== card( domain ) ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "slabs, parallelSelect and parallelForEach" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks that a space-filling curve range visits each point of the
+ * domain once, with increasing indices. If [adjacent] is true, also
+ * checks that consecutive points are 2N-neighbors.
+ */
+template <typename TRange, typename TDomain>
+bool checkCurveRange( const TRange & range, const TDomain & domain,
+		      bool adjacent )
+{
+  typedef typename TDomain::Point Point;
+  std::vector<Point> points;
+  bool ok = true;
+  for ( typename TRange::ConstIterator it = range.begin(), itE = range.end();
+	it != itE; ++it )
+    {
+      ok = ok && domain.isInside( *it ) && ( range.index( *it ) == it.index() );
+      if ( ! points.empty() )
+	{
+	  ok = ok && ( range.index( points.back() ) < it.index() );
+	  if ( adjacent )
+	    ok = ok && ( ( *it - points.back() ).norm( Point::L_1 ) == 1 );
+	}
+      points.push_back( *it );
+    }
+  std::vector<Point> ref( domain.begin(), domain.end() );
+  std::sort( points.begin(), points.end() );
+  std::sort( ref.begin(), ref.end() );
+  return ok && ( points == ref );
+}
+
+bool testSpaceFillingCurves()
+{
+  typedef SpaceND<2> TSpace2D;
+  typedef TSpace2D::Point Point2D;
+  typedef HyperRectDomain<TSpace2D> Domain2D;
+  typedef SpaceND<3> TSpace3D;
+  typedef TSpace3D::Point Point3D;
+  typedef HyperRectDomain<TSpace3D> Domain3D;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Test Morton and Hilbert ranges" );
+  // The Morton order of the 2x2 cube.
+  Domain2D square( Point2D( 4, -1 ), Point2D( 5, 0 ) );
+  typedef SpaceFillingCurveRange< Domain2D, MortonCurve<Point2D> > Morton2D;
+  Morton2D m2( square );
+  Morton2D::ConstIterator it = m2.begin();
+  nbok += ( *it++ == Point2D( 4, -1 ) ) && ( *it++ == Point2D( 5, -1 ) )
+    && ( *it++ == Point2D( 4, 0 ) ) && ( *it++ == Point2D( 5, 0 ) )
+    && ( it == m2.end() ) ? 1 : 0;
+  nb++;
+
+  // Hilbert curve over a whole cube is a path of neighbors.
+  Domain3D cube( Point3D( -4, 0, 3 ), Point3D( 3, 7, 10 ) );
+  typedef SpaceFillingCurveRange< Domain3D, HilbertCurve<Point3D> > Hilbert3D;
+  typedef SpaceFillingCurveRange< Domain3D, MortonCurve<Point3D> > Morton3D;
+  nbok += checkCurveRange( Hilbert3D( cube ), cube, true ) ? 1 : 0;
+  nb++;
+  nbok += checkCurveRange( Morton3D( cube ), cube, false ) ? 1 : 0;
+  nb++;
+
+  // Any box: points outside are skipped.
+  Domain3D box( Point3D( -2, 1, 0 ), Point3D( 10, 4, 2 ) );
+  nbok += checkCurveRange( Hilbert3D( box ), box, false ) ? 1 : 0;
+  nb++;
+  nbok += checkCurveRange( Morton3D( box ), box, false ) ? 1 : 0;
+  nb++;
+  Domain2D line( Point2D( 0, 0 ), Point2D( 100, 0 ) );
+  nbok += checkCurveRange( SpaceFillingCurveRange< Domain2D, HilbertCurve<Point2D> >( line ),
+			   line, false ) ? 1 : 0;
+  nb++;
+
+  // The largest extent fitting 32-bit indices in 2D (order 15).
+  Domain2D wide( Point2D( -5, 0 ), Point2D( 32762, 1 ) );
+  typedef SpaceFillingCurveRange< Domain2D,
+    MortonCurve<Point2D, DGtal::uint32_t> > Morton2D32;
+  Morton2D32 wideRange( wide );
+  nbok += ( wideRange.curve().order() == 15 )
+    && checkCurveRange( wideRange, wide, false ) ? 1 : 0;
+  nb++;
+
+  Domain3D empty( Point3D( 0, 5, 0 ), Point3D( 1, 2, 3 ) );
+  Hilbert3D emptyRange( empty );
+  nbok += ( emptyRange.begin() == emptyRange.end() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << Hilbert3D( box ) << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Numbering of the points of a domain and offsets of a neighborhood.
+ */
+bool testLinearizer()
+{
+  typedef SpaceND<3> TSpace3D;
+  typedef TSpace3D::Point Point3D;
+  typedef HyperRectDomain<TSpace3D> Domain3D;
+  typedef HyperRectDomainLinearizer<Domain3D> Linearizer;
+  typedef MetricAdjacency<TSpace3D, 2> Adj18;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Test HyperRectDomainLinearizer" );
+  Domain3D box( Point3D( -2, 1, 0 ), Point3D( 3, 4, 2 ) );
+  Linearizer lin( box );
+  nbok += ( lin.size() == 6 * 4 * 3 ) && ( lin.stride( 0 ) == 1 )
+    && ( lin.stride( 1 ) == 6 ) && ( lin.stride( 2 ) == 24 ) ? 1 : 0;
+  nb++;
+  // The indices follow the domain iterator.
+  Linearizer::Size i = 0;
+  bool ok = true;
+  for ( Domain3D::ConstIterator it = box.begin(); it != box.end(); ++it, ++i )
+    ok = ok && ( lin.index( *it ) == i );
+  nbok += ok ? 1 : 0;
+  nb++;
+  // The offsets of the neighbors match the indices.
+  std::vector<Linearizer::Offset> offsets;
+  lin.neighborOffsets<Adj18>( offsets );
+  const Point3D p( 0, 2, 1 );
+  ok = ( offsets.size() == 18 );
+  for ( unsigned int n = 0; ok && ( n < Adj18::nbNeighbors ); ++n )
+    ok = (Linearizer::Offset) lin.index( p + Adj18::offsets()[ n ] )
+      == (Linearizer::Offset) lin.index( p ) + offsets[ n ];
+  nbok += ok ? 1 : 0;
+  nb++;
+  // The points outside the box are not rasterized.
+  std::vector<Point3D> points;
+  points.push_back( Point3D( 3, 4, 2 ) );
+  points.push_back( Point3D( 4, 4, 2 ) );
+  std::vector<bool> mask;
+  lin.rasterize( mask, points.begin(), points.end(), true, false );
+  nbok += ( mask.size() == lin.size() )
+    && ( std::count( mask.begin(), mask.end(), true ) == 1 )
+    && mask[ lin.size() - 1 ] ? 1 : 0;
+  nb++;
+  // The linearizer can be reused for another domain.
+  lin.init( Domain3D( Point3D( 0, 0, 0 ), Point3D( 1, 1, 1 ) ) );
+  nbok += ( lin.size() == 8 ) && ( lin.index( Point3D( 1, 1, 1 ) ) == 7 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << lin << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
 
 int main()
 {
-  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() )
+  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat()
+       && testTraversal() && testParallelTraversal()
+       && testSpaceFillingCurves() && testLinearizer() )
     return 0;
   else
     return 1;
@@ -80,6 +80,19 @@ bool testImagesSetsUtilities()
   nbok += (imageBis(c) == 128) ? 1 : 0; 
   nb++;
 
+  //test of the parallelAppend method, on a random access set
+  typedef DigitalSetBySTLVector<Domain> VectorSet;
+  VectorSet vSet(Domain(a,b));
+  for ( int x = 0; x < 20; ++x )
+    vSet.insertNew( Point( x, 2 * x ) );
+  vSet.insertNew( Point( -1, 2 ) );
+  Image imageTer(a,b);
+  ImageFromSet<Image>::parallelAppend<VectorSet>(imageTer, vSet, 128, 3);
+  ImageFromSet<Image>::parallelAppend<DigitalSet>(imageTer, aSet, 64, 3);
+  nbok += (imageTer(Point(19,38)) == 128) && (imageTer(Point(1,1)) == 0)
+    && (imageTer(c) == 64) ? 1 : 0;
+  nb++;
+
 
   
   trace.info() << "(" << nbok << "/" << nb << ") "
@@ -134,6 +147,13 @@ bool testSetFromImage()
     trace.info()<< *it << endl;
   }
   trace.info()<< "Size=" << setFromImg.size();
+
+  Z2i::DigitalSet parallelSetFromImg (image2.domain());
+  SetFromImage<Z2i::DigitalSet>::parallelAppend
+    (parallelSetFromImg, image2,
+     SimpleForegroundPredicate<Image>(image2, 0, 255), 3);
+  nbok += ( parallelSetFromImg.size() == setFromImg.size() ) ? 1 : 0; 
+  nb++;
   
   Image setImage = ImageFromSet<Image>::create(setFromImg, 1,
 					       false, 
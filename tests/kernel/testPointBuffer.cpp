@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPointBuffer.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PointBuffer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/PointBuffer.h"
+#include "DGtal/images/Morton.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PointBuffer.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Compares the bulk operations of PointBuffer with the same
+ * operations on a vector of points.
+ */
+bool testPointBuffer()
+{
+  typedef SpaceND<3> Space;
+  typedef Space::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  typedef PointBuffer<3,Space::Integer> Buffer;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing PointBuffer ..." );
+  std::vector<Point> points;
+  srand( 7 );
+  for ( unsigned int i = 0; i < 1000; ++i )
+    points.push_back( Point( rand() % 50 - 20, rand() % 30 - 5, rand() % 40 ) );
+
+  Buffer buffer( points.begin(), points.end() );
+  std::vector<Point> back;
+  buffer.copyTo( std::back_inserter( back ) );
+  nbok += ( buffer.size() == points.size() ) && ( back == points )
+    && buffer.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << buffer << " conversion" << std::endl;
+
+  Point v( 3, -2, 1 );
+  buffer.translate( v );
+  bool ok = true;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    {
+      points[ i ] += v;
+      ok = ok && ( buffer[ i ] == points[ i ] );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+
+  Point lower, upper;
+  buffer.computeBoundingBox( lower, upper );
+  Point refLower( points[ 0 ] ), refUpper( points[ 0 ] );
+  for ( unsigned int i = 1; i < points.size(); ++i )
+    {
+      refLower = refLower.inf( points[ i ] );
+      refUpper = refUpper.sup( points[ i ] );
+    }
+  nbok += ( lower == refLower ) && ( upper == refUpper ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "translate, bbox=" << lower << " " << upper << std::endl;
+
+  Domain domain( Point( -10, 0, 5 ), Point( 20, 15, 30 ) );
+  std::vector<Point> inside;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    if ( domain.isInside( points[ i ] ) ) inside.push_back( points[ i ] );
+  buffer.keepInside( domain );
+  back.clear();
+  buffer.copyTo( std::back_inserter( back ) );
+  nbok += ( back == inside ) && buffer.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "keepInside: " << buffer.size() << " points" << std::endl;
+
+  typedef DGtal::uint64_t HashKey;
+  std::vector<HashKey> keys;
+  buffer.mortonKeys( keys, domain.lowerBound() );
+  Morton<HashKey,Point> morton;
+  ok = keys.size() == buffer.size();
+  for ( unsigned int i = 0; ok && i < buffer.size(); ++i )
+    {
+      HashKey h;
+      morton.interleaveBits( buffer[ i ] - domain.lowerBound(), h );
+      ok = ( h == keys[ i ] );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+
+  buffer.sort();
+  std::sort( inside.begin(), inside.end() );
+  back.clear();
+  buffer.copyTo( std::back_inserter( back ) );
+  nbok += ( back == inside ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "Morton keys and sort" << std::endl;
+
+  Buffer empty;
+  empty.translate( v );
+  empty.keepInside( domain );
+  empty.sort();
+  nbok += empty.empty() ? 1 : 0;
+  nb++;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PointBuffer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPointBuffer(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -255,6 +255,35 @@ bool testIntegerNorms()
   return nbok == nb;
 }
 
+bool testConversions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef PointVector<3,DGtal::int32_t> Point32;
+  typedef PointVector<3,DGtal::int16_t> Point16;
+  typedef PointVector<3,DGtal::uint16_t> PointU16;
+  trace.beginBlock ( "Checking conversions between coordinate types" );
+  Point32 p( 3, -4, 32767 );
+  Point16 q( p );
+  nbok += ( q[ 0 ] == 3 ) && ( q[ 1 ] == -4 ) && ( q[ 2 ] == 32767 ) ? 1 : 0;
+  nb++;
+  nbok += ( Point32( q ) == p ) ? 1 : 0;
+  nb++;
+  nbok += Point16::isRepresentable( p )
+    && ! Point16::isRepresentable( Point32( 0, 32768, 0 ) )
+    && ! Point16::isRepresentable( Point32( 0, 0, -32769 ) )
+    && ! PointU16::isRepresentable( q )
+    && PointU16::isRepresentable( Point16( 1, 2, 3 ) )
+    && Point32::isRepresentable( q ) ? 1 : 0;
+  nb++;
+  nbok += ( sizeof( Point16 ) == 3 * sizeof( DGtal::int16_t ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << p << " -> " << q << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 int main()
 {
   bool res;
@@ -264,7 +293,8 @@ int main()
     && testIterator() 
     && testComparison() 
     && testOperators()
-    && testIntegerNorms();
+    && testIntegerNorms()
+    && testConversions();
   if (res)
     return 0;
   else
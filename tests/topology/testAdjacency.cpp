@@ -32,7 +32,9 @@
 #include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DomainAdjacency.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -167,6 +169,101 @@ bool testMetricAdjacency()
   return nbok == nb;
 }
 
+/**
+ * Collects the points given to a functor.
+ */
+template <typename Point>
+struct PointCollector
+{
+  vector<Point> points;
+  void operator()( const Point & q ) { points.push_back( q ); }
+};
+
+/**
+ * Compares the unrolled enumeration of neighborhoods with the points
+ * of the cube [-1,1]^n around p whose displacement has a small 1-norm.
+ */
+template <typename Adjacency>
+bool testStencil( const typename Adjacency::Point & p,
+		  unsigned int maxNorm1 )
+{
+  typedef typename Adjacency::Space Space;
+  typedef typename Adjacency::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing unrolled neighborhood of" );
+  Adjacency::selfDisplay( trace.info() );
+  trace.info() << " p = " << p << std::endl;
+  vector<Point> expected;
+  Domain cube( p - Point::diagonal( 1 ), p + Point::diagonal( 1 ) );
+  for ( typename Domain::ConstIterator it = cube.begin();
+	it != cube.end(); ++it )
+    {
+      unsigned int n1 = (unsigned int) ( *it - p ).norm( Point::L_1 );
+      if ( ( n1 != 0 ) && ( n1 <= maxNorm1 ) ) expected.push_back( *it );
+    }
+  vector<Point> neighbors;
+  back_insert_iterator< vector<Point> > bii( neighbors );
+  Adjacency::writeProperNeighborhood( p, bii );
+  nbok += ( neighbors == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "writeProperNeighborhood gives the " << expected.size()
+	       << " neighbors in domain order" << std::endl;
+  PointCollector<Point> collector;
+  Adjacency::forEachNeighbor( p, collector );
+  nbok += ( collector.points == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "forEachNeighbor visits the same points" << std::endl;
+  bool ok = Adjacency::nbNeighbors == expected.size();
+  for ( unsigned int i = 0; ok && ( i < expected.size() ); ++i )
+    ok = p + Adjacency::offsets()[ i ] == expected[ i ];
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "offsets() are the displacements to the neighbors"
+	       << std::endl;
+
+  // Restricted to a domain containing only half of the neighbors.
+  Point upper( p + Point::diagonal( 1 ) );
+  upper[ 0 ] = p[ 0 ];
+  Domain domain( p - Point::diagonal( 1 ), upper );
+  Adjacency adjacency;
+  DomainAdjacency<Domain,Adjacency> dAdjacency( domain, adjacency );
+  vector<Point> inDomain;
+  back_insert_iterator< vector<Point> > biid( inDomain );
+  dAdjacency.writeProperNeighborhood( p, biid );
+  PointCollector<Point> dCollector;
+  dAdjacency.forEachNeighbor( p, dCollector );
+  nbok += ( dCollector.points == inDomain ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "DomainAdjacency::forEachNeighbor visits the "
+	       << inDomain.size() << " neighbors within the domain"
+	       << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testStencils()
+{
+  SpaceND<2>::Point p2( 3, -5 );
+  SpaceND<3>::Point p3( 3, -5, 10 );
+  int t4[] = { 1, 2, -3, 4 };
+  SpaceND<4>::Point p4( t4 );
+  return testStencil< MetricAdjacency< SpaceND<2>, 1> >( p2, 1 )
+    && testStencil< MetricAdjacency< SpaceND<2>, 2> >( p2, 2 )
+    && testStencil< MetricAdjacency< SpaceND<3>, 1> >( p3, 1 )
+    && testStencil< MetricAdjacency< SpaceND<3>, 2> >( p3, 2 )
+    && testStencil< MetricAdjacency< SpaceND<3>, 3> >( p3, 3 )
+    && testStencil< MetricAdjacency< SpaceND<4>, 2> >( p4, 2 )
+    && testStencil< MetricAdjacency< SpaceND<4>, 4> >( p4, 4 );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -178,7 +275,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMetricAdjacency(); // && ... other tests
+  bool res = testMetricAdjacency()
+    && testStencils(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdlib>
+#include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -38,6 +41,7 @@
 #include "DGtal/topology/SurfelNeighborhood.h"
 #include "DGtal/helpers/Shapes.h"
 #include "DGtal/helpers/Surfaces.h"
+#include "DGtal/helpers/FreemanSurfaces.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -320,6 +324,187 @@ bool testSurfelAdjacency()
   return nbok == nb;
 }
 
+/**
+ * Compares the scanning Surfaces::sMakeBoundary and uMakeBoundary
+ * with a direct look up of the spels on both sides of each surfel,
+ * for bounds that cut the shape and several numbers of threads.
+ */
+template <typename KSpace>
+bool testMakeBoundary()
+{
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sMakeBoundary and uMakeBoundary ..." );
+  KSpace K;
+  Point low = Point::diagonal( -8 );
+  Point high = Point::diagonal( 8 );
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( -2 ), 5 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point::diagonal( 3 ), 4 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point::diagonal( -2 ), 2 );
+  Point blow = Point::diagonal( -6 );
+  Point bhigh = Point::diagonal( 6 );
+  bhigh[ KSpace::dimension - 1 ] = 4;
+  Cell bLowCell = K.uSpel( blow );
+  Cell bHighCell = K.uSpel( bhigh );
+
+  std::set<SCell> ref;
+  Domain bounds( blow, bhigh );
+  for ( typename Domain::ConstIterator it = bounds.begin(),
+	  itE = bounds.end(); it != itE; ++it )
+    for ( Dimension k = 0; k < KSpace::dimension; ++k )
+      if ( (*it)[ k ] < bhigh[ k ] )
+	{
+	  Point q( *it );
+	  ++q[ k ];
+	  bool in_here = shape_set.find( *it ) != shape_set.end();
+	  bool in_further = shape_set.find( q ) != shape_set.end();
+	  if ( in_here != in_further )
+	    ref.insert( K.sIncident( K.sSpel( *it, in_here ? K.POS : K.NEG ),
+				     k, true ) );
+	}
+  for ( unsigned int nbThreads = 1; nbThreads <= 3; nbThreads += 2 )
+    {
+      std::set<SCell> sbdry;
+      std::set<Cell> ubdry;
+      Surfaces<KSpace>::sMakeBoundary( sbdry, K, shape_set,
+				       bLowCell, bHighCell, nbThreads );
+      Surfaces<KSpace>::uMakeBoundary( ubdry, K, shape_set,
+				       bLowCell, bHighCell, nbThreads );
+      nbok += ( sbdry == ref ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << "sMakeBoundary (" << nbThreads << " threads) size="
+		   << sbdry.size() << " == " << ref.size() << std::endl;
+      bool unsigned_ok = ubdry.size() == ref.size();
+      for ( typename std::set<SCell>::const_iterator it = ref.begin(),
+	      itE = ref.end(); it != itE; ++it )
+	unsigned_ok = unsigned_ok
+	  && ( ubdry.find( K.unsigns( *it ) ) != ubdry.end() );
+      nbok += unsigned_ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << "uMakeBoundary (" << nbThreads << " threads) size="
+		   << ubdry.size() << " == " << ref.size() << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares Surfaces::extractAll2DSCellContours with the extraction
+ * of the whole boundary followed by the tracking of the contour of
+ * its smallest remaining surfel, for both surfel adjacencies and
+ * contours touching the space borders.
+ */
+template <typename KSpace>
+bool testExtractAll2DSCellContours()
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::extractAll2DSCellContours ..." );
+  KSpace K;
+  Point low( -10, -10 );
+  Point high( 10, 10 );
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( -4, -4 ), 3 );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( 4, 3 ), 4 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point( 4, 3 ), 1 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 9, -9 ), 3 );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( -10, 7 ), 2 );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 60; ++i )
+    shape_set.insert( Point( rand() % 21 - 10, rand() % 21 - 10 ) );
+
+  for ( unsigned int a = 0; a < 2; ++a )
+    {
+      SurfelAdjacency<KSpace::dimension> SAdj( a == 0 );
+      std::vector< std::vector<SCell> > ref;
+      std::set<SCell> bdry;
+      Surfaces<KSpace>::sMakeBoundary( bdry, K, shape_set,
+				       K.uFirst( K.uSpel( low ) ),
+				       K.uLast( K.uSpel( high ) ) );
+      while ( ! bdry.empty() )
+	{
+	  std::vector<SCell> contour;
+	  Surfaces<KSpace>::track2DBoundary( contour, K, SAdj, shape_set,
+					     *( bdry.begin() ) );
+	  ref.push_back( contour );
+	  for ( unsigned int i = 0; i < contour.size(); ++i )
+	    bdry.erase( contour[ i ] );
+	}
+      std::vector< std::vector<SCell> > contours;
+      Surfaces<KSpace>::extractAll2DSCellContours( contours, K, SAdj,
+						   shape_set );
+      nbok += ( contours == ref ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << ( a == 0 ? "interior" : "exterior" )
+		   << " adjacency, nb contours=" << contours.size()
+		   << " == " << ref.size() << std::endl;
+
+      // Freeman chains, directly or through the points of the contours.
+      typedef FreemanChain<typename KSpace::Integer> FreemanChain;
+      std::vector< std::vector<Point> > points;
+      Surfaces<KSpace>::extractAllPointContours4C( points, K, shape_set, SAdj );
+      std::vector<FreemanChain> chains;
+      std::vector< std::pair<Point, Point> > boxes;
+      FreemanSurfaces<KSpace>::extractAllFreemanChains( chains, boxes, K, SAdj,
+							shape_set );
+      bool chains_ok = ( chains.size() == points.size() )
+	&& ( boxes.size() == points.size() );
+      bool track_ok = true;
+      for ( unsigned int i = 0; chains_ok && ( i < points.size() ); ++i )
+	{
+	  FreemanChain fc( points[ i ] );
+	  typename KSpace::Integer minX, minY, maxX, maxY;
+	  fc.computeBoundingBox( minX, minY, maxX, maxY );
+	  chains_ok = ( chains[ i ].chain == fc.chain )
+	    && ( chains[ i ].x0 == fc.x0 ) && ( chains[ i ].y0 == fc.y0 )
+	    && ( chains[ i ].xn == fc.xn ) && ( chains[ i ].yn == fc.yn )
+	    && ( boxes[ i ].first == Point( minX, minY ) )
+	    && ( boxes[ i ].second == Point( maxX, maxY ) );
+	  // Tracked from its last surfel, a contour is extracted as is.
+	  FreemanChain tracked;
+	  Point lowBB, upBB;
+	  FreemanSurfaces<KSpace>::track2DFreemanChain( tracked, lowBB, upBB, K, SAdj,
+							shape_set, contours[ i ].back() );
+	  track_ok = track_ok && ( tracked.chain == fc.chain )
+	    && ( tracked.x0 == fc.x0 ) && ( tracked.y0 == fc.y0 )
+	    && ( lowBB == boxes[ i ].first ) && ( upBB == boxes[ i ].second );
+	}
+      nbok += chains_ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << "extractAllFreemanChains == chains of the point contours"
+		   << std::endl;
+      nbok += track_ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << "track2DFreemanChain == chains of the point contours"
+		   << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 template <typename KSpace>
 bool testCellDrawOnBoard()
 {
@@ -409,6 +594,9 @@ int main( int argc, char** argv )
     && testSurfelAdjacency<K2>()
     && testSurfelAdjacency<K3>()
     && testSurfelAdjacency<K4>()
+    && testMakeBoundary<K2>()
+    && testMakeBoundary<K3>()
+    && testExtractAll2DSCellContours<K2>()
     && testCellDrawOnBoard<K2>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testComponentLabeling.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ComponentLabeling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Expander.h"
+#include "DGtal/topology/ComponentLabeling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ComponentLabeling.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Compares the components given by ComponentLabeling with the ones
+ * given by Expander on a random 3D object.
+ */
+template <typename TObject>
+bool testComponentLabeling( const TObject & object )
+{
+  typedef ComponentLabeling<TObject> Labeling;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename DigitalSet::ConstIterator ConstIterator;
+  typedef typename Labeling::Label Label;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ComponentLabeling ..." );
+  Labeling labeling( object );
+  trace.info() << labeling << std::endl;
+  nbok += labeling.isValid() ? 1 : 0;
+  nb++;
+
+  // Each component is the expansion of any of its points.
+  bool ok = true;
+  unsigned int nbPoints = 0;
+  for ( Label l = 1; l <= labeling.nbComponents(); ++l )
+    {
+      Expander<TObject> expander( object, *labeling.begin( l ) );
+      while ( expander.nextLayer() )
+	;
+      unsigned int n = std::distance( labeling.begin( l ), labeling.end( l ) );
+      nbPoints += n;
+      ok = ok && ( expander.core().size() == n );
+      for ( typename Labeling::ConstIterator it = labeling.begin( l );
+	    it != labeling.end( l ); ++it )
+	ok = ok && ( labeling.label( *it ) == l )
+	  && ( expander.core().find( *it ) != expander.core().end() );
+    }
+  nbok += ok && ( nbPoints == object.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "components are the expansions of their points" << std::endl;
+
+  ok = true;
+  for ( ConstIterator it = object.pointSet().begin();
+	it != object.pointSet().end(); ++it )
+    ok = ok && ( labeling.label( *it ) != 0 );
+  nbok += ok
+    && ( labeling.label( object.domain().upperBound()
+			 + TObject::Point::diagonal( 1 ) ) == 0 ) ? 1 : 0;
+  nb++;
+
+  std::vector<TObject> components;
+  std::back_insert_iterator< std::vector<TObject> > itComponents( components );
+  unsigned int nbComponents = object.writeComponents( itComponents );
+  ok = ( nbComponents == labeling.nbComponents() );
+  for ( unsigned int i = 0; ok && i < components.size(); ++i )
+    ok = ( components[ i ].size()
+	   == (unsigned int) std::distance( labeling.begin( i + 1 ),
+					    labeling.end( i + 1 ) ) )
+      && ( components[ i ].connectedness() == TObject::CONNECTED );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "writeComponents: " << nbComponents << " components" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ComponentLabeling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  using namespace Z3i;
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  DigitalSet set( domain );
+  srand( 11 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( rand() % 4 == 0 ) set.insertNew( *it );
+  Object6_18 object6( dt6_18, set );
+  Object26_6 object26( dt26_6, set );
+  DigitalSet empty( domain );
+  Object6_18 emptyObject( dt6_18, empty );
+  Z2i::Domain domain2( Z2i::Point( 0, 0 ), Z2i::Point( 30, 20 ) );
+  Z2i::DigitalSet set2( domain2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin(); it != domain2.end(); ++it )
+    if ( rand() % 2 == 0 ) set2.insertNew( *it );
+  Z2i::Object4_8 object4( Z2i::dt4_8, set2 );
+
+  bool res = testComponentLabeling( object6 )
+    && testComponentLabeling( object26 )
+    && testComponentLabeling( emptyObject )
+    && testComponentLabeling( object4 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponents.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ConnectedComponents.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/ConnectedComponents.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponents.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Labels the components of [image] by breadth-first traversals along
+ * MetricAdjacency, as reference.
+ * @return the number of components.
+ */
+template <typename Image, typename LabelImage, Dimension maxNorm1>
+unsigned int referenceLabels( const Image & image, LabelImage & labels )
+{
+  typedef typename Image::Domain Domain;
+  typedef typename Domain::Space Space;
+  typedef typename Domain::Point Point;
+  typedef MetricAdjacency<Space,maxNorm1> Adjacency;
+  Adjacency adjacency;
+  const unsigned int none = (unsigned int) -1;
+  const Domain domain = image.domain();
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    labels.setValue( *it, none );
+  unsigned int n = 0;
+  std::vector<Point> queue, neighbors;
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    {
+      if ( labels( *it ) != none ) continue;
+      queue.clear();
+      queue.push_back( *it );
+      labels.setValue( *it, n );
+      for ( unsigned int head = 0; head < queue.size(); ++head )
+	{
+	  const Point p = queue[ head ];
+	  neighbors.clear();
+	  std::back_insert_iterator< std::vector<Point> > out( neighbors );
+	  adjacency.writeProperNeighborhood( p, out );
+	  for ( unsigned int j = 0; j < neighbors.size(); ++j )
+	    if ( domain.isInside( neighbors[ j ] )
+		 && ( labels( neighbors[ j ] ) == none )
+		 && ( image( neighbors[ j ] ) == image( p ) ) )
+	      {
+		labels.setValue( neighbors[ j ], n );
+		queue.push_back( neighbors[ j ] );
+	      }
+	}
+      ++n;
+    }
+  return n;
+}
+
+/**
+ * Compares ConnectedComponents with the reference labeling on a
+ * random image with a few values, for several numbers of threads.
+ */
+template <typename Domain, Dimension maxNorm1>
+bool testConnectedComponents( const Domain & domain, int nbValues )
+{
+  typedef ImageContainerBySTLVector<Domain,int> Image;
+  typedef ImageContainerBySTLVector<Domain,unsigned int> LabelImage;
+  typedef ConnectedComponents<Image,maxNorm1> Components;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ConnectedComponents ..." );
+  Image image( domain.lowerBound(), domain.upperBound() );
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    image.setValue( *it, rand() % nbValues );
+  LabelImage reference( domain.lowerBound(), domain.upperBound() );
+  unsigned int nbReference =
+    referenceLabels<Image,LabelImage,maxNorm1>( image, reference );
+
+  for ( unsigned int nbThreads = 1; nbThreads <= 4; nbThreads += 3 )
+    {
+      Components cc( image, nbThreads );
+      LabelImage labels( domain.lowerBound(), domain.upperBound() );
+      cc.writeLabels( labels );
+      // The two labelings should be the same up to a bijection.
+      std::map<unsigned int, unsigned int> toReference, fromReference;
+      bool ok = ( cc.nbComponents() == nbReference ) && cc.isValid();
+      for ( typename Domain::ConstIterator it = domain.begin();
+	    ok && ( it != domain.end() ); ++it )
+	{
+	  unsigned int l = cc.label( *it );
+	  unsigned int r = reference( *it );
+	  ok = ( labels( *it ) == l ) && ( l < cc.nbComponents() );
+	  if ( toReference.count( l ) == 0 ) toReference[ l ] = r;
+	  if ( fromReference.count( r ) == 0 ) fromReference[ r ] = l;
+	  ok = ok && ( toReference[ l ] == r ) && ( fromReference[ r ] == l );
+	}
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << cc
+		   << " reference=" << nbReference
+		   << " threads=" << nbThreads << std::endl;
+    }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks that labeling more points than the type of labels can
+ * number throws an exception.
+ */
+bool testLabelOverflow()
+{
+  typedef SpaceND<2> Z2;
+  typedef HyperRectDomain<Z2> Domain;
+  typedef ImageContainerBySTLVector<Domain,int> Image;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing label overflow ..." );
+  Image small( Z2::Point( 0, 0 ), Z2::Point( 15, 15 ) );
+  Image large( Z2::Point( 0, 0 ), Z2::Point( 16, 15 ) );
+  bool ok = false;
+  try
+    {
+      ConnectedComponents<Image,1,DGtal::uint8_t> cc( small );
+      ok = cc.nbComponents() == 1;
+    }
+  catch ( InputException & e )
+    {
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "256 points with 8-bit labels" << std::endl;
+  ok = false;
+  try
+    {
+      ConnectedComponents<Image,1,DGtal::uint8_t> cc( large );
+    }
+  catch ( InputException & e )
+    {
+      ok = true;
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "272 points with 8-bit labels throws" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponents" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef SpaceND<2> Z2;
+  typedef SpaceND<3> Z3;
+  typedef HyperRectDomain<Z2> Domain2;
+  typedef HyperRectDomain<Z3> Domain3;
+  Domain2 domain2( Z2::Point( -5, 2 ), Z2::Point( 40, 30 ) );
+  Domain3 domain3( Z3::Point( -3, -2, 0 ), Z3::Point( 12, 14, 17 ) );
+  srand( 5 );
+  bool res = testConnectedComponents<Domain2,1>( domain2, 2 )
+    && testConnectedComponents<Domain2,2>( domain2, 3 )
+    && testConnectedComponents<Domain3,1>( domain3, 2 )
+    && testConnectedComponents<Domain3,2>( domain3, 3 )
+    && testConnectedComponents<Domain3,3>( domain3, 4 )
+    && testLabelOverflow();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
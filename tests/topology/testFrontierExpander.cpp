@@ -0,0 +1,152 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFrontierExpander.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class FrontierExpander.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Expander.h"
+#include "DGtal/topology/FrontierExpander.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FrontierExpander.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Counts the points given to FrontierExpander::expand, and keeps the
+ * largest distance.
+ */
+template <typename TPoint>
+struct LayerCounter
+{
+  LayerCounter() : nbPoints( 0 ), maxDistance( 0 ) {}
+  void operator()( const TPoint &, unsigned int d )
+  {
+    ++nbPoints;
+    if ( d > maxDistance ) maxDistance = d;
+  }
+  unsigned int nbPoints;
+  unsigned int maxDistance;
+};
+
+/**
+ * Compares the layers of FrontierExpander with the ones of Expander,
+ * from the first [nbSeeds] points of [object].
+ */
+template <typename TObject>
+bool testFrontierExpander( const TObject & object, unsigned int nbSeeds )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::DigitalSet::ConstIterator SetConstIterator;
+  typedef FrontierExpander<TObject> Frontier;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing FrontierExpander ..." );
+  std::vector<Point> seeds;
+  SetConstIterator itSeed = object.pointSet().begin();
+  for ( unsigned int i = 0; i < nbSeeds; ++i, ++itSeed )
+    seeds.push_back( *itSeed );
+
+  Expander<TObject> expander( object, seeds.begin(), seeds.end() );
+  Frontier frontier( object, seeds.begin(), seeds.end() );
+  bool ok = true;
+  unsigned int nbVisited = 0;
+  while ( ok && ! expander.finished() )
+    {
+      ok = ( ! frontier.finished() )
+	&& ( frontier.distance() == expander.distance() )
+	&& ( frontier.layer().size() == expander.layer().size() );
+      for ( typename Frontier::ConstIterator it = frontier.begin();
+	    ok && ( it != frontier.end() ); ++it )
+	ok = expander.layer().find( *it ) != expander.layer().end();
+      nbVisited += frontier.layer().size();
+      expander.nextLayer();
+      frontier.nextLayer();
+    }
+  trace.info() << frontier << std::endl;
+  nbok += ok && frontier.finished() && frontier.layer().empty()
+    && frontier.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same layers as Expander, " << nbVisited << " points"
+	       << std::endl;
+
+  Frontier frontier2( object, seeds.begin(), seeds.end() );
+  LayerCounter<Point> counter;
+  frontier2.expand( counter );
+  nbok += ( counter.nbPoints == nbVisited )
+    && ( counter.maxDistance == expander.distance() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "expand() visits " << counter.nbPoints << " points up to "
+	       << counter.maxDistance << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class FrontierExpander" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  using namespace Z3i;
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  DigitalSet set( domain );
+  srand( 13 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( rand() % 3 != 0 ) set.insertNew( *it );
+  Z2i::Domain domain2( Z2i::Point( -20, -20 ), Z2i::Point( 20, 20 ) );
+  Z2i::DigitalSet set2( domain2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin();
+	it != domain2.end(); ++it )
+    if ( rand() % 4 != 0 ) set2.insertNew( *it );
+
+  bool res = testFrontierExpander( Object6_18( dt6_18, set ), 1 )
+    && testFrontierExpander( Object26_6( dt26_6, set ), 3 )
+    && testFrontierExpander( Z2i::Object4_8( Z2i::dt4_8, set2 ), 1 )
+    && testFrontierExpander( Z2i::Object8_4( Z2i::dt8_4, set2 ), 5 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testGeodesicDistance.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class GeodesicDistance.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/Expander.h"
+#include "DGtal/topology/GeodesicDistance.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class GeodesicDistance.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the geodesic distances from several seeds with the
+ * smallest layer index of one Expander per seed, and the weighted
+ * distances with a plain Dijkstra traversal.
+ */
+template <typename TObject>
+bool testGeodesicDistance( const TObject & object, unsigned int nbSeeds,
+			   const std::vector<DGtal::uint32_t> & weights )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::DigitalSet::ConstIterator SetConstIterator;
+  typedef GeodesicDistance<TObject> Geodesic;
+  typedef typename Geodesic::Distance Distance;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing GeodesicDistance ..." );
+  std::vector<Point> seeds;
+  SetConstIterator itSeed = object.pointSet().begin();
+  for ( unsigned int i = 0; i < nbSeeds; ++i )
+    {
+      seeds.push_back( *itSeed );
+      for ( unsigned int j = 0; j < 97; ++j ) ++itSeed;
+    }
+
+  // One expander per seed.
+  std::map<Point, Distance> reference;
+  for ( unsigned int i = 0; i < seeds.size(); ++i )
+    {
+      Expander<TObject> expander( object, seeds[ i ] );
+      reference[ seeds[ i ] ] = 0;
+      for ( ; ! expander.finished(); expander.nextLayer() )
+	for ( typename Expander<TObject>::ConstIterator it = expander.begin();
+	      it != expander.end(); ++it )
+	  if ( ( reference.find( *it ) == reference.end() )
+	       || ( reference[ *it ] > expander.distance() ) )
+	    reference[ *it ] = expander.distance();
+    }
+
+  Geodesic geodesic( object );
+  geodesic.compute( seeds.begin(), seeds.end() );
+  trace.info() << geodesic << std::endl;
+  bool ok = geodesic.isValid();
+  for ( SetConstIterator it = object.pointSet().begin();
+	ok && ( it != object.pointSet().end() ); ++it )
+    ok = ( reference.find( *it ) == reference.end() )
+      ? ( geodesic.distance( *it ) == Geodesic::infinity() )
+      : ( geodesic.distance( *it ) == reference[ *it ] );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same distances as one Expander per seed" << std::endl;
+
+  // Repeated seeds are taken once.
+  std::vector<Point> repeated( seeds.begin(), seeds.end() );
+  repeated.insert( repeated.end(), seeds.rbegin(), seeds.rend() );
+  repeated.push_back( seeds.front() );
+  Geodesic twice( object );
+  twice.compute( repeated.begin(), repeated.end() );
+  ok = true;
+  for ( SetConstIterator it = object.pointSet().begin();
+	ok && ( it != object.pointSet().end() ); ++it )
+    ok = twice.distance( *it ) == geodesic.distance( *it );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "repeated seeds give the same distances" << std::endl;
+
+  // Unit weights give the number of steps.
+  std::vector<Distance> ones( Point::dimension + 1, 1 );
+  Geodesic unit( object );
+  unit.compute( seeds.begin(), seeds.end(), ones );
+  ok = true;
+  for ( SetConstIterator it = object.pointSet().begin();
+	ok && ( it != object.pointSet().end() ); ++it )
+    ok = unit.distance( *it ) == geodesic.distance( *it );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "unit weights give the same distances" << std::endl;
+
+  // Plain Dijkstra with a map as priority queue.
+  geodesic.compute( seeds.begin(), seeds.end(), weights );
+  std::map<Point, Distance> dist;
+  std::multimap<Distance, Point> queue;
+  for ( unsigned int i = 0; i < seeds.size(); ++i )
+    {
+      dist[ seeds[ i ] ] = 0;
+      queue.insert( std::make_pair( (Distance) 0, seeds[ i ] ) );
+    }
+  while ( ! queue.empty() )
+    {
+      const Distance d = queue.begin()->first;
+      const Point p = queue.begin()->second;
+      queue.erase( queue.begin() );
+      if ( dist[ p ] != d ) continue;
+      std::vector<Point> neighbors;
+      std::back_insert_iterator< std::vector<Point> > out( neighbors );
+      object.adjacency().writeProperNeighborhood( p, out );
+      for ( unsigned int n = 0; n < neighbors.size(); ++n )
+	{
+	  const Point & q = neighbors[ n ];
+	  if ( object.pointSet().find( q ) == object.pointSet().end() )
+	    continue;
+	  const Distance dq = d + weights[ (unsigned int) ( q - p ).norm
+					   ( Point::L_1 ) ];
+	  if ( ( dist.find( q ) == dist.end() ) || ( dq < dist[ q ] ) )
+	    {
+	      dist[ q ] = dq;
+	      queue.insert( std::make_pair( dq, q ) );
+	    }
+	}
+    }
+  ImageContainerBySTLVector<Domain,Distance> image( object.domain().lowerBound(),
+						     object.domain().upperBound() );
+  geodesic.writeDistances( image );
+  ok = true;
+  for ( SetConstIterator it = object.pointSet().begin();
+	ok && ( it != object.pointSet().end() ); ++it )
+    ok = ( dist.find( *it ) == dist.end() )
+      ? ( image( *it ) == Geodesic::infinity() )
+      : ( image( *it ) == dist[ *it ] );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "weighted distances are the ones of Dijkstra" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class GeodesicDistance" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  using namespace Z3i;
+  Domain domain( Point( -8, -8, -8 ), Point( 8, 8, 8 ) );
+  DigitalSet set( domain );
+  srand( 17 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( rand() % 3 != 0 ) set.insertNew( *it );
+  Z2i::Domain domain2( Z2i::Point( -20, -20 ), Z2i::Point( 20, 20 ) );
+  Z2i::DigitalSet set2( domain2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin();
+	it != domain2.end(); ++it )
+    if ( rand() % 4 != 0 ) set2.insertNew( *it );
+
+  // Chamfer weights.
+  std::vector<DGtal::uint32_t> w345( 4 );
+  w345[ 1 ] = 3; w345[ 2 ] = 4; w345[ 3 ] = 5;
+  std::vector<DGtal::uint32_t> w57( 3 );
+  w57[ 1 ] = 5; w57[ 2 ] = 7;
+  bool res = testGeodesicDistance( Object26_6( dt26_6, set ), 4, w345 )
+    && testGeodesicDistance( Object6_18( dt6_18, set ), 3, w345 )
+    && testGeodesicDistance( Z2i::Object8_4( Z2i::dt8_4, set2 ), 5, w57 )
+    && testGeodesicDistance( Z2i::Object4_8( Z2i::dt4_8, set2 ), 2, w57 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHomotopicThinning.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class HomotopicThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/ComponentLabeling.h"
+#include "DGtal/topology/HomotopicThinning.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HomotopicThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The anchor of the tests: the points whose first coordinate is null.
+ */
+template <typename TPoint>
+struct FirstCoordinateIsNull
+{
+  bool operator()( const TPoint & p ) const { return p[ 0 ] == 0; }
+};
+
+/**
+ * @return the numbers of components of [object] and of its
+ * complement in [domain], which should contain the object and its
+ * neighbors.
+ */
+template <typename TObject>
+std::pair<unsigned int, unsigned int>
+nbComponents( const TObject & object, const typename TObject::Domain & domain )
+{
+  typedef typename TObject::ComplementObject ComplementObject;
+  typename TObject::DigitalSet complement( domain );
+  for ( typename TObject::Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    if ( object.pointSet().find( *it ) == object.pointSet().end() )
+      complement.insertNew( *it );
+  ComplementObject cobject( object.topology().reverseTopology(), complement );
+  ComponentLabeling<TObject> labeling( object );
+  ComponentLabeling<ComplementObject> clabeling( cobject );
+  return std::make_pair( (unsigned int) labeling.nbComponents(),
+			 (unsigned int) clabeling.nbComponents() );
+}
+
+/**
+ * Thins [object] without and with priority and anchors, and checks
+ * that the results keep the topology and have no simple point left.
+ */
+template <typename TObject>
+bool testHomotopicThinning( const TObject & object )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename DigitalSet::ConstIterator ConstIterator;
+  typedef HomotopicThinning<TObject> Thinning;
+  typedef ImageContainerBySTLVector<Domain,int> PriorityImage;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing HomotopicThinning ..." );
+  // The complement is taken around the domain of the object.
+  const Domain domain( object.domain().lowerBound() - Point::diagonal( 1 ),
+		       object.domain().upperBound() + Point::diagonal( 1 ) );
+  const std::pair<unsigned int, unsigned int> before
+    = nbComponents( object, domain );
+
+  TObject thin1( object );
+  Thinning thinning1( thin1, 1 );
+  unsigned int nbRemoved = thinning1.thin();
+  trace.info() << thinning1 << " removed " << nbRemoved << "/"
+	       << object.size() << std::endl;
+  nbok += thinning1.isValid()
+    && ( thin1.size() + nbRemoved == object.size() ) ? 1 : 0;
+  nb++;
+
+  bool ok = true;
+  for ( ConstIterator it = thin1.pointSet().begin();
+	it != thin1.pointSet().end(); ++it )
+    ok = ok && ( object.pointSet().find( *it ) != object.pointSet().end() )
+      && ! thin1.isSimple( *it );
+  nbok += ok && ( nbComponents( thin1, domain ) == before ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "thinned subset without simple points, same topology"
+	       << std::endl;
+
+  TObject thin4( object );
+  Thinning thinning4( thin4, 4 );
+  thinning4.thin();
+  ok = ( thin4.size() == thin1.size() );
+  for ( ConstIterator it = thin4.pointSet().begin();
+	it != thin4.pointSet().end(); ++it )
+    ok = ok && ( thin1.pointSet().find( *it ) != thin1.pointSet().end() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same result with 4 threads" << std::endl;
+
+  // Priority: the distance to the lower bound, so that the points
+  // are removed from the lowest first. Anchors: first coordinate null.
+  PriorityImage priority( domain.lowerBound(), domain.upperBound() );
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    priority.setValue( *it, (int) ( *it - domain.lowerBound() ).norm
+		       ( Point::L_1 ) );
+  FirstCoordinateIsNull<Point> anchor;
+  TObject thin2( object );
+  Thinning thinning2( thin2, 4 );
+  thinning2.thin( priority, anchor );
+  ok = true;
+  for ( ConstIterator it = object.pointSet().begin();
+	it != object.pointSet().end(); ++it )
+    if ( anchor( *it ) )
+      ok = ok && ( thin2.pointSet().find( *it ) != thin2.pointSet().end() );
+  for ( ConstIterator it = thin2.pointSet().begin();
+	it != thin2.pointSet().end(); ++it )
+    ok = ok && ( anchor( *it ) || ! thin2.isSimple( *it ) );
+  nbok += ok && ( nbComponents( thin2, domain ) == before ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "anchors are kept: " << thin2.size() << " points" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HomotopicThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  // A ring with two bars and a random set, in 3D.
+  using namespace Z3i;
+  Domain domain( Point( -14, -14, -14 ), Point( 14, 14, 14 ) );
+  DigitalSet ring( domain );
+  DigitalSet noise( domain );
+  srand( 3 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      const double n = ( *it ).norm();
+      if ( ( n <= 12 ) && ( n >= 8 )
+	   && ( ( std::abs( ( *it )[ 0 ] ) <= 2 )
+		|| ( std::abs( ( *it )[ 1 ] ) <= 2 ) ) )
+	ring.insertNew( *it );
+      if ( ( n <= 10 ) && ( rand() % 3 != 0 ) )
+	noise.insertNew( *it );
+    }
+  // A square annulus and a random set, in 2D.
+  Z2i::Domain domain2( Z2i::Point( -20, -20 ), Z2i::Point( 20, 20 ) );
+  Z2i::DigitalSet set2( domain2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin();
+	it != domain2.end(); ++it )
+    {
+      const int n = (int) ( *it ).norm( Z2i::Point::L_infty );
+      if ( ( ( n >= 5 ) && ( n <= 15 ) ) || ( ( n > 15 ) && ( rand() % 2 ) ) )
+	set2.insertNew( *it );
+    }
+
+  bool res = testHomotopicThinning( Object26_6( dt26_6, ring ) )
+    && testHomotopicThinning( Object6_26( dt6_26, ring ) )
+    && testHomotopicThinning( Object18_6( dt18_6, noise ) )
+    && testHomotopicThinning( Object6_18( dt6_18, noise ) )
+    && testHomotopicThinning( Z2i::Object8_4( Z2i::dt8_4, set2 ) )
+    && testHomotopicThinning( Z2i::Object4_8( Z2i::dt4_8, set2 ) );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,7 @@
 #include "DGtal/topology/DigitalTopology.h"
 #include "DGtal/topology/Object.h"
 #include "DGtal/topology/Expander.h"
+#include "DGtal/topology/BorderExtractor.h"
 #include "DGtal/io-viewers/DGtalBoard.h"
 #include "DGtal/io-viewers/colormaps/GradientColorMap.h"
 #include "DGtal/helpers/Shapes.h"
@@ -659,6 +660,210 @@ bool testSimplePoints2D()
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
+/**
+ * Checks that an object with 16-bit coordinates (Z3i16) behaves as the
+ * same object with 32-bit coordinates (Z3i).
+ */
+bool testCompactObject3D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Object with 16-bit coordinates ..." );
+  Z3i::Domain domain( Z3i::Point( -8, -8, -8 ), Z3i::Point( 8, 8, 8 ) );
+  Z3i16::Domain domain16( Z3i16::Point( domain.lowerBound() ),
+			  Z3i16::Point( domain.upperBound() ) );
+  Z3i::DigitalSet set( domain );
+  Z3i16::DigitalSet set16( domain16 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    if ( ( (*it).norm() <= 6.0 ) || ( (*it - Z3i::Point( 7, 7, 7 ) ).norm() < 1.0 ) )
+      {
+	set.insertNew( *it );
+	set16.insertNew( Z3i16::Point( *it ) );
+      }
+  Z3i::Object6_18 object( Z3i::dt6_18, set );
+  Z3i16::Object6_18 object16( Z3i16::dt6_18, set16 );
+  INBLOCK_TEST( sizeof( Z3i16::Point ) * 2 == sizeof( Z3i::Point ) );
+  INBLOCK_TEST( object16.size() == object.size() );
+  INBLOCK_TEST( object16.border().size() == object.border().size() );
+  std::vector< Z3i::Object6_18 > cc;
+  std::vector< Z3i16::Object6_18 > cc16;
+  back_insert_iterator< std::vector< Z3i::Object6_18 > > itCC( cc );
+  back_insert_iterator< std::vector< Z3i16::Object6_18 > > itCC16( cc16 );
+  unsigned int nbCC = object.writeComponents( itCC );
+  unsigned int nbCC16 = object16.writeComponents( itCC16 );
+  INBLOCK_TEST( nbCC16 == nbCC && nbCC == 2 );
+  Z3i16::KSpace K16;
+  INBLOCK_TEST( K16.init( domain16.lowerBound(), domain16.upperBound(), true ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks BorderExtractor and Object::border against the definition of
+ * the border, on a random object touching the bounds of its domain.
+ */
+template <typename TObject>
+bool testBorderExtractor( const TObject & object )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename DigitalSet::ConstIterator ConstIterator;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing BorderExtractor ..." );
+  DigitalSet border( object.domain() );
+  for ( ConstIterator it = object.pointSet().begin();
+	it != object.pointSet().end(); ++it )
+    {
+      std::vector<Point> neighbors;
+      back_insert_iterator< std::vector<Point> > out( neighbors );
+      object.topology().lambda().writeProperNeighborhood
+	( *it, out, object.domain().predicate() );
+      for ( unsigned int i = 0; i < neighbors.size(); ++i )
+	if ( object.pointSet().find( neighbors[ i ] ) == object.pointSet().end() )
+	  {
+	    border.insertNew( *it );
+	    break;
+	  }
+    }
+  BorderExtractor<TObject> extractor( object );
+  trace.info() << extractor << std::endl;
+  bool ok = extractor.isValid() && ( extractor.size() == border.size() );
+  for ( typename BorderExtractor<TObject>::ConstIterator
+	  it = extractor.begin(); ok && ( it != extractor.end() ); ++it )
+    ok = border.find( *it ) != border.end();
+  INBLOCK_TEST( ok );
+  TObject objectBorder = object.border();
+  ok = ( objectBorder.size() == border.size() );
+  for ( ConstIterator it = border.begin(); ok && ( it != border.end() ); ++it )
+    ok = objectBorder.pointSet().find( *it ) != objectBorder.pointSet().end();
+  INBLOCK_TEST( ok );
+  trace.info() << border.size() << " border points out of "
+	       << object.size() << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testBorderExtractors()
+{
+  Z3i::Domain domain( Z3i::Point( -6, -6, -6 ), Z3i::Point( 6, 6, 6 ) );
+  Z3i::DigitalSet set( domain );
+  Z2i::Domain domain2( Z2i::Point( -12, -12 ), Z2i::Point( 12, 12 ) );
+  Z2i::DigitalSet set2( domain2 );
+  srand( 5 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    if ( rand() % 4 != 0 ) set.insertNew( *it );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin();
+	it != domain2.end(); ++it )
+    if ( rand() % 3 != 0 ) set2.insertNew( *it );
+  return testBorderExtractor( Z3i::Object6_18( Z3i::dt6_18, set ) )
+    && testBorderExtractor( Z3i::Object26_6( Z3i::dt26_6, set ) )
+    && testBorderExtractor( Z2i::Object4_8( Z2i::dt4_8, set2 ) )
+    && testBorderExtractor( Z2i::Object8_4( Z2i::dt8_4, set2 ) );
+}
+
+/**
+ * Edits an object with a neighborhood size cache through insert() and
+ * erase(), and compares its neighborhood sizes and its connectedness
+ * with the ones of a copy without cache.
+ */
+template <typename TObject>
+bool testNeighborhoodSizeCache( TObject object )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  typedef typename Domain::ConstIterator DomainConstIterator;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing neighborhood size cache ..." );
+  std::vector<Point> points;
+  for ( DomainConstIterator it = object.domain().begin();
+	it != object.domain().end(); ++it )
+    points.push_back( *it );
+  object.computeConnectedness();
+  object.enableNeighborhoodSizeCache();
+  bool ok = object.hasNeighborhoodSizeCache();
+  unsigned int nbKnown = 0;
+  for ( unsigned int n = 0; ok && ( n < 2000 ); ++n )
+    {
+      const Point & p = points[ rand() % points.size() ];
+      if ( rand() % 2 == 0 ) object.insert( p );
+      else object.erase( p );
+      if ( n == 1000 ) // the cache is released, then computed again.
+	{
+	  object.pointSet().insert( points[ rand() % points.size() ] );
+	  ok = ! object.hasNeighborhoodSizeCache();
+	  object.enableNeighborhoodSizeCache();
+	}
+      if ( n % 100 != 0 ) continue;
+      const TObject & constObject = object;
+      TObject reference( constObject.topology(), constObject.pointSet() );
+      if ( object.connectedness() != TObject::UNKNOWN )
+	{
+	  ++nbKnown;
+	  ok = object.connectedness() == reference.computeConnectedness();
+	}
+      for ( unsigned int i = 0; ok && ( i < points.size() ); ++i )
+	ok = ( object.neighborhoodSize( points[ i ] )
+	       == reference.neighborhoodSize( points[ i ] ) )
+	  && ( object.properNeighborhoodSize( points[ i ] )
+	       == reference.properNeighborhoodSize( points[ i ] ) );
+    }
+  INBLOCK_TEST( ok );
+  trace.info() << "connectedness known " << nbKnown << " times" << std::endl;
+
+  // Growing an empty object with adjacent points keeps it connected.
+  TObject grown( object.topology(), object.domain() );
+  grown.enableNeighborhoodSizeCache();
+  for ( unsigned int n = 0; n < 2000; ++n )
+    {
+      const Point & p = points[ rand() % points.size() ];
+      if ( ( grown.size() == 0 ) || ( grown.properNeighborhoodSize( p ) != 0 ) )
+	grown.insert( p );
+    }
+  const TObject & constGrown = grown;
+  TObject reference( constGrown.topology(), constGrown.pointSet() );
+  INBLOCK_TEST( ( grown.connectedness() == TObject::CONNECTED )
+		&& ( reference.computeConnectedness() == TObject::CONNECTED ) );
+  // The cache of the grown object has been enlarged as needed.
+  ok = grown.hasNeighborhoodSizeCache();
+  for ( unsigned int i = 0; ok && ( i < points.size() ); ++i )
+    ok = grown.properNeighborhoodSize( points[ i ] )
+      == reference.properNeighborhoodSize( points[ i ] );
+  INBLOCK_TEST( ok );
+  object.disableNeighborhoodSizeCache();
+  INBLOCK_TEST( ! object.hasNeighborhoodSizeCache() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testNeighborhoodSizeCaches()
+{
+  Z3i::Domain domain( Z3i::Point( -4, -4, -4 ), Z3i::Point( 4, 4, 4 ) );
+  Z3i::DigitalSet set( domain );
+  Z2i::Domain domain2( Z2i::Point( -8, -8 ), Z2i::Point( 8, 8 ) );
+  Z2i::DigitalSet set2( domain2 );
+  srand( 7 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    if ( rand() % 2 != 0 ) set.insertNew( *it );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin();
+	it != domain2.end(); ++it )
+    if ( rand() % 4 != 0 ) set2.insertNew( *it );
+  return testNeighborhoodSizeCache( Z3i::Object26_6( Z3i::dt26_6, set ) )
+    && testNeighborhoodSizeCache( Z3i::Object6_18( Z3i::dt6_18, set ) )
+    && testNeighborhoodSizeCache( Z2i::Object8_4( Z2i::dt8_4, set2 ) )
+    && testNeighborhoodSizeCache( Z2i::Object4_8( Z2i::dt4_8, set2 ) );
+}
+
 int main( int argc, char** argv )
 {
   trace.beginBlock ( "Testing class Object" );
@@ -670,7 +875,10 @@ int main( int argc, char** argv )
   bool res = testObject() && 
     testObject3D() && testDraw()
     && testSimplePoints3D()
-    && testSimplePoints2D();
+    && testSimplePoints2D()
+    && testCompactObject3D()
+    && testBorderExtractors()
+    && testNeighborhoodSizeCaches();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
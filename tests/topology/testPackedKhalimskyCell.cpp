@@ -0,0 +1,183 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskyCell.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing classes PackedKhalimskyCell and
+ * PackedSignedKhalimskyCell.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <boost/unordered_set.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/PackedKhalimskyCell.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedKhalimskyCell.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Compares the services of packed cells with the ones of the space,
+ * for all the cells of a small space.
+ */
+template <typename KSpace>
+bool testPackedKhalimskyCell( const typename KSpace::Point & low,
+			      const typename KSpace::Point & high )
+{
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef PackedKhalimskyCell< KSpace::dimension,
+    typename KSpace::Integer > PackedCell;
+  typedef PackedSignedKhalimskyCell< KSpace::dimension,
+    typename KSpace::Integer > PackedSCell;
+  const Dimension dim = KSpace::dimension;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing packed cells ..." );
+  KSpace K;
+  K.init( low, high, true );
+  trace.info() << "sizeof(SCell)=" << sizeof( SCell )
+	       << " sizeof(PackedSCell)=" << sizeof( PackedSCell ) << endl;
+  nbok += ( sizeof( PackedCell ) == 8 ) && ( sizeof( PackedSCell ) == 8 )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "packed cells weigh 8 bytes" << std::endl;
+
+  // All the cells, given by their Khalimsky coordinates.
+  Domain kDomain( K.uKCoords( K.uFirst( K.uSpel( low ) ) )
+		  - Point::diagonal( 1 ),
+		  K.uKCoords( K.uLast( K.uSpel( high ) ) )
+		  + Point::diagonal( 1 ) );
+  bool ok = true;
+  unsigned int nbCells = 0;
+  std::set<PackedSCell> ordered;
+  boost::unordered_set<PackedSCell, boost::hash<PackedSCell> > hashed;
+  for ( typename Domain::ConstIterator it = kDomain.begin();
+	ok && ( it != kDomain.end() ); ++it, ++nbCells )
+    {
+      const Cell c = K.uCell( *it );
+      const PackedCell pc( c );
+      ok = ( pc.cell() == c ) && ( pc.uDim() == K.uDim( c ) )
+	&& ( pc.uTopology() == (unsigned int) K.uTopology( c ) );
+      for ( Dimension k = 0; ok && ( k < dim ); ++k )
+	{
+	  ok = ( pc.uIsOpen( k ) == K.uIsOpen( c, k ) )
+	    && ( pc.uKCoord( k ) == K.uKCoord( c, k ) );
+	  if ( ok && ( K.uKCoord( c, k ) < K.uKCoord( K.uLast( c ), k ) ) )
+	    ok = pc.uAdjacent( k, true ).cell() == K.uAdjacent( c, k, true );
+	  if ( ok && ( K.uKCoord( K.uFirst( c ), k ) < K.uKCoord( c, k ) ) )
+	    ok = pc.uAdjacent( k, false ).cell() == K.uAdjacent( c, k, false );
+	}
+      for ( int s = 0; ok && ( s < 2 ); ++s )
+	{
+	  const SCell sc = K.sCell( *it, s == 0 ? K.POS : K.NEG );
+	  const PackedSCell psc( sc );
+	  ok = ( psc.scell() == sc ) && ( psc.sSign() == K.sSign( sc ) )
+	    && ( psc.sOpp().scell() == K.sOpp( sc ) )
+	    && ( psc.unsigns() == pc ) && ( psc.sDim() == K.sDim( sc ) );
+	  for ( Dimension k = 0; ok && ( k < dim ); ++k )
+	    {
+	      const bool inside = ( K.uKCoord( K.uFirst( c ), k )
+				    < K.uKCoord( c, k ) )
+		&& ( K.uKCoord( c, k ) < K.uKCoord( K.uLast( c ), k ) );
+	      ok = psc.sDirect( k ) == K.sDirect( sc, k );
+	      if ( ok && inside )
+		ok = ( psc.sIncident( k, true ).scell()
+		       == K.sIncident( sc, k, true ) )
+		  && ( psc.sIncident( k, false ).scell()
+		       == K.sIncident( sc, k, false ) )
+		  && ( psc.sDirectIncident( k ).scell()
+		       == K.sDirectIncident( sc, k ) )
+		  && ( psc.sIndirectIncident( k ).scell()
+		       == K.sIndirectIncident( sc, k ) );
+	    }
+	  ordered.insert( psc );
+	  hashed.insert( psc );
+	}
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same services as the space on " << nbCells << " cells"
+	       << std::endl;
+  nbok += ( ordered.size() == 2 * nbCells ) && ( hashed.size() == 2 * nbCells )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "the keys are distinct in a set and a hash set" << std::endl;
+  Point kmin = Point::diagonal( PackedCell::minKCoord() );
+  Point kmax = Point::diagonal( PackedCell::maxKCoord() );
+  ok = ( PackedCell( kmin ).uKCoords() == kmin )
+    && ( PackedCell( kmax ).uKCoords() == kmax )
+    && ( PackedSCell( kmax, false ).sKCoords() == kmax )
+    && ( PackedCell( kmin ) < PackedCell( kmax ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "extreme coordinates [" << PackedCell::minKCoord() << ","
+	       << PackedCell::maxKCoord() << "] are represented" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedKhalimskyCell" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND<2> K2;
+  typedef KhalimskySpaceND<3> K3;
+  typedef KhalimskySpaceND<4> K4;
+  int xlow4[ 4 ] = { -3, -2, -2, -1 };
+  int xhigh4[ 4 ] = { 2, 1, 2, 1 };
+  bool res = testPackedKhalimskyCell<K2>( K2::Point( -4, -3 ),
+					  K2::Point( 5, 3 ) )
+    && testPackedKhalimskyCell<K3>( K3::Point( -3, -2, -2 ),
+				    K3::Point( 3, 2, 1 ) )
+    && testPackedKhalimskyCell<K4>( K4::Point( xlow4 ), K4::Point( xhigh4 ) );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
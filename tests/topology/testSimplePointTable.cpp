@@ -0,0 +1,155 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplePointTable.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class SimplePointTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SimplePointTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SimplePointTable.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * The definition of simple points through the geodesic
+ * neighborhoods, as computed by Object::isSimple for any topology.
+ */
+template <typename TObject>
+bool isSimpleByGeodesicNeighborhoods( const TObject & X,
+				      const typename TObject::Point & v )
+{
+  typedef typename TObject::SmallObject SmallObject;
+  typedef typename TObject::SmallComplementObject SmallComplementObject;
+  const unsigned int k = TObject::Space::dimension;
+  SmallObject G = X.geodesicNeighborhood( X.topology().kappa(), v, k );
+  if ( G.pointSet().empty()
+       || ( G.computeConnectedness() != SmallObject::CONNECTED ) )
+    return false;
+  SmallComplementObject Gc
+    = X.geodesicNeighborhoodInComplement( X.topology().lambda(), v, k );
+  return ( ! Gc.pointSet().empty() )
+    && ( Gc.computeConnectedness() == SmallComplementObject::CONNECTED );
+}
+
+/**
+ * Compares Object::isSimple with the definition through the geodesic
+ * neighborhoods, on [nbConfigurations] configurations of the
+ * neighborhood of the origin (all of them if [nbConfigurations] is
+ * 0).
+ */
+template <typename TObject>
+bool testSimplePointTable( const typename TObject::DigitalTopology & dt,
+			   unsigned int nbConfigurations )
+{
+  typedef typename TObject::DigitalTopology DigitalTopology;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::Point Point;
+  typedef SimplePointTable<DigitalTopology> Table;
+  typedef typename Table::Configuration Configuration;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SimplePointTable ..." );
+  const Table & table = Table::instance();
+  trace.info() << table << std::endl;
+  nbok += table.isValid() ? 1 : 0;
+  nb++;
+
+  const Point origin = Point::diagonal( 0 );
+  const Domain domain( Point::diagonal( -2 ), Point::diagonal( 2 ) );
+  const Domain neighborhood( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+  const bool all = ( nbConfigurations == 0 );
+  if ( all ) nbConfigurations = 1u << Table::size;
+  unsigned int nbSimple = 0;
+  bool ok = true;
+  for ( unsigned int i = 0; i < nbConfigurations; ++i )
+    {
+      DigitalSet set( domain );
+      Configuration c = 0;
+      Configuration bit = 1;
+      const int density = 1 + rand() % 3;
+      for ( typename Domain::ConstIterator it = neighborhood.begin();
+	    it != neighborhood.end(); ++it, bit <<= 1 )
+	if ( all ? ( ( i & bit ) != 0 ) : ( rand() % 4 < density ) )
+	  {
+	    set.insertNew( *it );
+	    c |= bit;
+	  }
+      TObject X( dt, set );
+      const bool simple = X.isSimple( origin );
+      nbSimple += simple ? 1 : 0;
+      ok = ok && ( table.configuration( set, origin ) == c )
+	&& ( table.computeIsSimple( c ) == simple )
+	&& ( table.isSimple( c ) == simple )
+	&& ( isSimpleByGeodesicNeighborhoods( X, origin ) == simple );
+      if ( ! ok )
+	{
+	  trace.error() << "Configuration " << c << " differs." << std::endl;
+	  break;
+	}
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbSimple << " simple points in " << nbConfigurations
+	       << " configurations" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SimplePointTable" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 7 );
+  bool res = testSimplePointTable<Z2i::Object4_8>( Z2i::dt4_8, 0 )
+    && testSimplePointTable<Z2i::Object8_4>( Z2i::dt8_4, 0 )
+    && testSimplePointTable<Z3i::Object6_18>( Z3i::dt6_18, 2000 )
+    && testSimplePointTable<Z3i::Object18_6>( Z3i::dt18_6, 2000 )
+    && testSimplePointTable<Z3i::Object6_26>( Z3i::dt6_26, 2000 )
+    && testSimplePointTable<Z3i::Object26_6>( Z3i::dt26_6, 2000 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelSet.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class SurfelSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelSet.h"
+#include "DGtal/helpers/Shapes.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfelSet.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Inserts all the signed cells of a small space twice, and checks
+ * size, count, find and clear against std::set.
+ */
+template <typename KSpace>
+bool testSurfelSetServices( bool useBitmap )
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef SurfelSet<KSpace> Set;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( useBitmap
+		     ? "Testing SurfelSet services (bitmap)."
+		     : "Testing SurfelSet services (hash table)." );
+  KSpace K;
+  Point low = Point::diagonal( -3 );
+  Point high = Point::diagonal( 2 );
+  K.init( low, high, true );
+  Domain kdomain( Point::diagonal( -6 ), Point::diagonal( 6 ) );
+  Set cells( K, useBitmap );
+  std::set<SCell> ref;
+  nbok += cells.empty() && ( cells.usesBitmap() == useBitmap ) ? 1 : 0;
+  nb++;
+  bool inserted_ok = true;
+  for ( typename Domain::ConstIterator it = kdomain.begin(),
+	  itE = kdomain.end(); it != itE; ++it )
+    { // Positive cells first, negative cells second.
+      SCell c = K.sCell( *it, K.POS );
+      std::pair<typename Set::ConstIterator,bool> first = cells.insert( c );
+      std::pair<typename Set::ConstIterator,bool> again = cells.insert( c );
+      inserted_ok = inserted_ok && first.second && ( *first.first == c )
+	&& ! again.second && ( again.first == first.first );
+      ref.insert( c );
+    }
+  for ( typename Domain::ConstIterator it = kdomain.begin(),
+	  itE = kdomain.end(); it != itE; ++it )
+    {
+      SCell c = K.sCell( *it, K.NEG );
+      inserted_ok = inserted_ok && ( cells.count( c ) == 0 )
+	&& ( cells.find( c ) == cells.end() );
+      cells.insert( c );
+      ref.insert( c );
+    }
+  nbok += inserted_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "insert returns true once per cell, " << cells << std::endl;
+  nbok += ( cells.size() == ref.size() ) && cells.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "size=" << cells.size() << " == " << ref.size() << std::endl;
+  bool found_ok = true;
+  for ( typename std::set<SCell>::const_iterator it = ref.begin(),
+	  itE = ref.end(); it != itE; ++it )
+    found_ok = found_ok && ( cells.count( *it ) == 1 )
+      && ( cells.find( *it ) != cells.end() ) && ( *cells.find( *it ) == *it );
+  nbok += found_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "all cells are found" << std::endl;
+  std::set<SCell> iterated( cells.begin(), cells.end() );
+  nbok += ( iterated == ref ) && ( *cells.begin() == *ref.find( *cells.begin() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "iteration visits all cells" << std::endl;
+  cells.clear();
+  bool cleared_ok = cells.empty() && ( cells.begin() == cells.end() );
+  for ( typename std::set<SCell>::const_iterator it = ref.begin(),
+	  itE = ref.end(); it != itE; ++it )
+    cleared_ok = cleared_ok && ( cells.count( *it ) == 0 );
+  cells.insert( ref.begin(), ref.end() );
+  nbok += cleared_ok && ( cells.size() == ref.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "clear empties the set, which can be refilled" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Tracks the boundary of a shape with std::set and with SurfelSet,
+ * which must give the same surfels.
+ */
+template <typename KSpace>
+bool testSurfelSetTracking()
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type
+    DigitalSet;
+  typedef SurfelSet<KSpace> Set;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing boundary tracking with SurfelSet." );
+  Point low = Point::diagonal( -12 );
+  Point high = Point::diagonal( 12 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape( domain );
+  Shapes<Domain>::addNorm2Ball( shape, Point::diagonal( -2 ), 7 );
+  Shapes<Domain>::addNorm2Ball( shape, Point::diagonal( 4 ), 5 );
+  Shapes<Domain>::removeNorm2Ball( shape, Point::diagonal( 5 ), 2 );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, shape, 10000 );
+
+  std::set<SCell> ref;
+  Set hashed( K );
+  Set bitmap( K, true );
+  Surfaces<KSpace>::trackBoundary( ref, K, SAdj, shape, bel );
+  Surfaces<KSpace>::trackBoundary( hashed, K, SAdj, shape, bel );
+  Surfaces<KSpace>::trackBoundary( bitmap, K, SAdj, shape, bel );
+  nbok += ( ref.size() == hashed.size() )
+    && ( ref == std::set<SCell>( hashed.begin(), hashed.end() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "trackBoundary std::set=" << ref.size()
+	       << " hashed=" << hashed.size() << std::endl;
+  nbok += ( ref.size() == bitmap.size() )
+    && ( ref == std::set<SCell>( bitmap.begin(), bitmap.end() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "trackBoundary std::set=" << ref.size()
+	       << " bitmap=" << bitmap.size() << std::endl;
+
+  // The sets are cleared by the tracking.
+  std::set<SCell> ref_closed;
+  Surfaces<KSpace>::trackClosedBoundary( ref_closed, K, SAdj, shape, bel );
+  Surfaces<KSpace>::trackClosedBoundary( hashed, K, SAdj, shape, bel );
+  Surfaces<KSpace>::trackClosedBoundary( bitmap, K, SAdj, shape, bel );
+  nbok += ( ref_closed.size() == hashed.size() )
+    && ( ref_closed == std::set<SCell>( hashed.begin(), hashed.end() ) )
+    && ( ref_closed.size() == bitmap.size() )
+    && ( ref_closed == std::set<SCell>( bitmap.begin(), bitmap.end() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "trackClosedBoundary std::set=" << ref_closed.size()
+	       << " hashed=" << hashed.size()
+	       << " bitmap=" << bitmap.size() << std::endl;
+  nbok += ( ref_closed == ref ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "closed boundary == boundary" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SurfelSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND<2> K2;
+  typedef KhalimskySpaceND<3> K3;
+  bool res = testSurfelSetServices<K2>( false )
+    && testSurfelSetServices<K2>( true )
+    && testSurfelSetServices<K3>( false )
+    && testSurfelSetServices<K3>( true )
+    && testSurfelSetTracking<K2>()
+    && testSurfelSetTracking<K3>();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,7 @@
 #include "DGtal/geometry/2d/FreemanChain.h"
 
 #include "DGtal/io-viewers/DGtalBoard.h"
-#include "DGtal/helpers/Surfaces.h"
+#include "DGtal/helpers/FreemanSurfaces.h"
 
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
@@ -170,26 +170,27 @@ int main( int argc, char** argv )
     }
     SurfelAdjacency<2> sAdj( true );
   
-    std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
-    Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
-						      ks, set2d, sAdj );  
-    for(unsigned int i=0; i<vectContoursBdryPointels.size(); i++){
-      if(vectContoursBdryPointels.at(i).size()>minSize){
+    std::vector< FreemanChain<Z2i::Integer> > vectChains;
+    FreemanSurfaces<Z2i::KSpace>::extractAllFreemanChains( vectChains,
+							   ks, sAdj, set2d );  
+    for(unsigned int i=0; i<vectChains.size(); i++){
+      const FreemanChain<Z2i::Integer> & fc = vectChains.at(i);
+      // a chain of n codes joins n+1 points.
+      if(fc.chain.size()+1>minSize){
 	if(select){
-	  Z2i::Point ptMean = ContourHelper::getMeanPoint(vectContoursBdryPointels.at(i));
+	  std::vector< Z2i::Point > contour;
+	  FreemanChain<Z2i::Integer>::getContourPoints(fc, contour);
+	  Z2i::Point ptMean = ContourHelper::getMeanPoint(contour);
 	  unsigned int distance = (unsigned int)(sqrt((ptMean[0]-selectCenter[0])*(ptMean[0]-selectCenter[0])+
 				    (ptMean[1]-selectCenter[1])*(ptMean[1]-selectCenter[1])));
 	  if(distance<=selectDistanceMax){
-	    FreemanChain<Z2i::Integer> fc (vectContoursBdryPointels.at(i));    
 	    cout << fc.x0 << " " << fc.y0   << " " << fc.chain << endl; 
 	  }
 	}else{
-	  FreemanChain<Z2i::Integer> fc (vectContoursBdryPointels.at(i));    
 	  cout << fc.x0 << " " << fc.y0   << " " << fc.chain << endl; 
 	}
 
       }
-
     }
   
 
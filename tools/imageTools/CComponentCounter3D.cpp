@@ -32,10 +32,9 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/io-viewers/readers/VolReader.h"
 
-#include "Board/Color.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/topology/ConnectedComponents.h"
 
-#include <boost/pending/disjoint_sets.hpp>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
 #include <boost/program_options/variables_map.hpp>
@@ -48,66 +47,19 @@ using namespace Z3i;
 namespace po = boost::program_options;
 
 
-
-template <typename Rank, typename Parent, typename Image>
-void CCCounter(Rank& r, Parent& p, const Image& elements, const unsigned int connectivity)
+/**
+ * Counts the components of equal values of [image] for the
+ * adjacency of given [maxNorm1] (1, 2 and 3 for 6, 18 and 26).
+ */
+template <Dimension maxNorm1, typename Image>
+void CCCounter( const Image & image, const unsigned int connectivity )
 {
-  
-  boost::disjoint_sets<Rank,Parent> dsets(r, p);
-  trace.beginBlock("Initial disjoint sets construction");
-  for(typename Image::Domain::ConstIterator e = elements.domain().begin();
-      e != elements.domain().end(); ++e)
-    dsets.make_set(*e);
-  trace.endBlock();
-
-  trace.beginBlock("Merging neighboring sets");
-  typename Image::Point decx(1,0,0);
-  typename Image::Point decy(0,1,0);
-  typename Image::Point decz(0,0,1);
-  
-  //Merging process
-  for(typename Image::Domain::ConstIterator e = elements.domain().begin();
-      e !=elements.domain().end(); ++e)
-    {
-      if ( elements.domain().isInside(*e+decx) &&  
-	   (elements(*e) == elements(*e+decx)))
- 	dsets.union_set(*e,*e+decx);
-      
-      if ( elements.domain().isInside(*e+decy) &&  
-	   (elements(*e) == elements(*e+decy)))
-	dsets.union_set(*e,*e+decy);
-      
-      if ( elements.domain().isInside(*e+decz) &&  
-	   (elements(*e) == elements(*e+decz)))
-	dsets.union_set(*e,*e+decz);
-
-      if (connectivity > 6)
-	{
-	  if ( elements.domain().isInside(*e+decx+decy) &&  
-	       (elements(*e) == elements(*e+decx+decy)))
-	    dsets.union_set(*e,*e+decx+decy);
-      
-	  if ( elements.domain().isInside(*e+decx+decz) &&  
-	       (elements(*e) == elements(*e+decx+decz)))
-	    dsets.union_set(*e,*e+decx+decz);
-	
-	  if ( elements.domain().isInside(*e+decy+decz) &&  
-	       (elements(*e) == elements(*e+decy+decz)))
-	    dsets.union_set(*e,*e+decy+decz);
-	
-	  if (connectivity == 26)
-	    if ( elements.domain().isInside(*e+decy+decz+decx) &&  
-		 (elements(*e) == elements(*e+decy+decz+decx)))
-	      dsets.union_set(*e,*e+decy+decz+decx);
-	  
-	}
-      
-    }
+  trace.beginBlock( "Labeling the components" );
+  ConnectedComponents<Image,maxNorm1> components( image );
   trace.endBlock();
   std::cout << "Number of disjoint "<<connectivity<<"-components = "
-	       <<dsets.count_sets(elements.domain().begin(),
-				  elements.domain().end())
-	       << std::endl;
+	    << components.nbComponents()
+	    << std::endl;
 }
 
 
@@ -146,16 +98,12 @@ int main( int argc, char** argv )
 
  trace.info() << "Image loaded: "<<image<< std::endl;
 
- typedef std::map<Point,std::size_t> rank_t; // => order on Element
- typedef std::map<Point,Point> parent_t;
- rank_t rank_map;
- parent_t parent_map;
- 
- boost::associative_property_map<rank_t>   rank_pmap(rank_map);
- boost::associative_property_map<parent_t> parent_pmap(parent_map);
- 
- CCCounter(rank_pmap, parent_pmap, image, connectivity);
- 
+ if ( connectivity == 6 )
+   CCCounter<1>( image, connectivity );
+ else if ( connectivity == 18 )
+   CCCounter<2>( image, connectivity );
+ else
+   CCCounter<3>( image, connectivity );
 
  return 0;
 }